@@ -0,0 +1,251 @@
+# Generates the translation units used by the compile time benchmark.
+#
+# Every generated signature is inspected through Traits::FunctionTraits: the arity and qualifiers are checked with
+# static_asserts and every Argument<N> / ArgumentDecayed<N> is named, so that the benchmark measures the full cost of a
+# typical FunctionTraits user and doubles as a correctness check for all specializations.
+
+# qualifier text | FunctionQualifiers designated initializer
+set(TRAITS_BENCH_QUALIFIERS
+    "|"
+    "const|.isConst = true"
+    "volatile|.isVolatile = true"
+    "const volatile|.isConst = true, .isVolatile = true"
+    "&|.isReferenceQualified = true"
+    "const&|.isConst = true, .isReferenceQualified = true"
+    "volatile&|.isVolatile = true, .isReferenceQualified = true"
+    "const volatile&|.isConst = true, .isVolatile = true, .isReferenceQualified = true"
+    "&&|.isRvalueReferenceQualified = true"
+    "const&&|.isConst = true, .isRvalueReferenceQualified = true"
+    "volatile&&|.isVolatile = true, .isRvalueReferenceQualified = true"
+    "const volatile&&|.isConst = true, .isVolatile = true, .isRvalueReferenceQualified = true"
+    "noexcept|.isNoexcept = true"
+    "const noexcept|.isConst = true, .isNoexcept = true"
+    "volatile noexcept|.isVolatile = true, .isNoexcept = true"
+    "const volatile noexcept|.isConst = true, .isVolatile = true, .isNoexcept = true"
+    "& noexcept|.isReferenceQualified = true, .isNoexcept = true"
+    "const& noexcept|.isConst = true, .isReferenceQualified = true, .isNoexcept = true"
+    "volatile& noexcept|.isVolatile = true, .isReferenceQualified = true, .isNoexcept = true"
+    "const volatile& noexcept|.isConst = true, .isVolatile = true, .isReferenceQualified = true, .isNoexcept = true"
+    "&& noexcept|.isRvalueReferenceQualified = true, .isNoexcept = true"
+    "const&& noexcept|.isConst = true, .isRvalueReferenceQualified = true, .isNoexcept = true"
+    "volatile&& noexcept|.isVolatile = true, .isRvalueReferenceQualified = true, .isNoexcept = true"
+    "const volatile&& noexcept|.isConst = true, .isVolatile = true, .isRvalueReferenceQualified = true, .isNoexcept = true"
+)
+
+set(TRAITS_BENCH_PRELUDE "
+template <int>
+struct A
+{};
+template <int>
+struct R
+{};
+template <int>
+struct C
+{};
+")
+
+# Produces a comma separated argument list with a mix of value, reference and pointer parameters.
+function(_traits_bench_argument_list arity offset outVar)
+    set(args "")
+    if (arity GREATER 0)
+        math(EXPR last "${arity} - 1")
+        foreach (i RANGE 0 ${last})
+            math(EXPR kind "(${i} + ${offset}) % 4")
+            math(EXPR index "(${i} + ${offset}) % 97")
+            if (kind EQUAL 0)
+                set(arg "A<${index}>")
+            elseif (kind EQUAL 1)
+                set(arg "A<${index}> const&")
+            elseif (kind EQUAL 2)
+                set(arg "A<${index}>&&")
+            else()
+                set(arg "A<${index}> const*")
+            endif()
+            if (i EQUAL 0)
+                set(args "${arg}")
+            else()
+                string(APPEND args ", ${arg}")
+            endif()
+        endforeach()
+    endif()
+    set(${outVar} "${args}" PARENT_SCOPE)
+endfunction()
+
+# Emits the checks for a single signature.
+function(_traits_bench_inspect outVar id type arity qualifiersInit classType)
+    set(code "namespace S${id}\n{\n")
+    string(APPEND code "    using Tr = ${TRAITS_BENCH_TRAITS_TEMPLATE}<${type}>;\n")
+    string(APPEND code "    static_assert(Tr::arity == ${arity});\n")
+    string(APPEND code "    static_assert(Tr::qualifiers == ::Traits::FunctionQualifiers{${qualifiersInit}});\n")
+    string(APPEND code "    using Return = Tr::ReturnType;\n")
+    if (NOT classType STREQUAL "")
+        string(APPEND code "    using Class = Tr::ClassType;\n")
+    endif()
+    if (arity GREATER 0)
+        math(EXPR last "${arity} - 1")
+        foreach (i RANGE 0 ${last})
+            string(APPEND code "    using Arg${i} = Tr::Argument<${i}>;\n")
+            string(APPEND code "    using Decayed${i} = Tr::ArgumentDecayed<${i}>;\n")
+        endforeach()
+    endif()
+    string(APPEND code "}\n")
+    set(${outVar} "${code}" PARENT_SCOPE)
+endfunction()
+
+function(_traits_bench_split_qualifier entry textVar initVar)
+    string(FIND "${entry}" "|" separator)
+    string(SUBSTRING "${entry}" 0 ${separator} text)
+    math(EXPR initStart "${separator} + 1")
+    string(SUBSTRING "${entry}" ${initStart} -1 init)
+    set(${textVar} "${text}" PARENT_SCOPE)
+    set(${initVar} "${init}" PARENT_SCOPE)
+endfunction()
+
+# Writes a translation unit only when its content changed, so that reconfiguring does not touch the sources.
+function(_traits_bench_write path prologue body)
+    set(content "// Generated by generate_signatures.cmake - do not edit.\n${prologue}\n${TRAITS_BENCH_PRELUDE}\n${body}")
+    if (EXISTS "${path}")
+        file(READ "${path}" previous)
+        if (previous STREQUAL content)
+            return()
+        endif()
+    endif()
+    file(WRITE "${path}" "${content}")
+endfunction()
+
+# All qualifier variants of plain function types and (where allowed) function pointers, arity 0 - 7.
+function(_traits_bench_qualifiers_tu outVar countVar)
+    set(body "")
+    set(id 0)
+    foreach (entry IN LISTS TRAITS_BENCH_QUALIFIERS)
+        _traits_bench_split_qualifier("${entry}" qualifier init)
+        foreach (arity RANGE 0 7)
+            foreach (variant RANGE 0 4)
+                _traits_bench_argument_list(${arity} ${variant} args)
+                _traits_bench_inspect(code ${id} "R<${id}>(${args}) ${qualifier}" ${arity} "${init}" "")
+                string(APPEND body "${code}")
+                math(EXPR id "${id} + 1")
+                if (qualifier STREQUAL "" OR qualifier STREQUAL "noexcept")
+                    _traits_bench_inspect(code ${id} "R<${id}> (*)(${args}) ${qualifier}" ${arity} "${init}" "")
+                    string(APPEND body "${code}")
+                    math(EXPR id "${id} + 1")
+                endif()
+            endforeach()
+        endforeach()
+    endforeach()
+    set(${outVar} "${body}" PARENT_SCOPE)
+    set(${countVar} ${id} PARENT_SCOPE)
+endfunction()
+
+# All qualifier variants of member function pointers over a set of classes, arity 0 - 7.
+function(_traits_bench_member_pointers_tu outVar countVar)
+    set(body "")
+    set(id 0)
+    foreach (entry IN LISTS TRAITS_BENCH_QUALIFIERS)
+        _traits_bench_split_qualifier("${entry}" qualifier init)
+        foreach (arity RANGE 0 7)
+            foreach (variant RANGE 0 4)
+                _traits_bench_argument_list(${arity} ${variant} args)
+                math(EXPR class "${id} % 31")
+                _traits_bench_inspect(
+                    code ${id} "R<${id}> (C<${class}>::*)(${args}) ${qualifier}" ${arity} "${init}" "C<${class}>")
+                string(APPEND body "${code}")
+                math(EXPR id "${id} + 1")
+            endforeach()
+        endforeach()
+    endforeach()
+    set(${outVar} "${body}" PARENT_SCOPE)
+    set(${countVar} ${id} PARENT_SCOPE)
+endfunction()
+
+# Wide signatures with arity 0 - 64 where every argument index is queried.
+function(_traits_bench_arity_tu outVar countVar)
+    set(body "")
+    set(id 0)
+    foreach (arity RANGE 0 64)
+        _traits_bench_argument_list(${arity} ${arity} args)
+        _traits_bench_inspect(code ${id} "R<${id}>(${args})" ${arity} "" "")
+        string(APPEND body "${code}")
+        math(EXPR id "${id} + 1")
+        _traits_bench_inspect(code ${id} "R<${id}> (*)(${args}) noexcept" ${arity} ".isNoexcept = true" "")
+        string(APPEND body "${code}")
+        math(EXPR id "${id} + 1")
+        _traits_bench_inspect(
+            code ${id} "R<${id}> (C<0>::*)(${args}) const&" ${arity} ".isConst = true, .isReferenceQualified = true" "C<0>")
+        string(APPEND body "${code}")
+        math(EXPR id "${id} + 1")
+    endforeach()
+    set(${outVar} "${body}" PARENT_SCOPE)
+    set(${countVar} ${id} PARENT_SCOPE)
+endfunction()
+
+# Lambdas and function objects, which go through the operator() lookup of FunctionTraits.
+function(_traits_bench_lambdas_tu outVar countVar)
+    set(body "")
+    set(id 0)
+    foreach (arity RANGE 0 32)
+        foreach (variant RANGE 0 3)
+            _traits_bench_argument_list(${arity} ${variant} args)
+            if (variant EQUAL 0)
+                set(specifiers "")
+                set(init ".isConst = true")
+            elseif (variant EQUAL 1)
+                set(specifiers "mutable")
+                set(init "")
+            elseif (variant EQUAL 2)
+                set(specifiers "noexcept")
+                set(init ".isConst = true, .isNoexcept = true")
+            else()
+                set(specifiers "mutable noexcept")
+                set(init ".isNoexcept = true")
+            endif()
+            string(APPEND body "inline auto lambda${id} = [](${args}) ${specifiers} -> R<${id}> {\n    return {};\n};\n")
+            _traits_bench_inspect(code ${id} "decltype(lambda${id})" ${arity} "${init}" "")
+            string(APPEND body "${code}")
+            math(EXPR id "${id} + 1")
+
+            string(APPEND body "struct FunctionObject${id}\n{\n    R<${id}> operator()(${args}) const;\n};\n")
+            _traits_bench_inspect(code ${id} "FunctionObject${id}" ${arity} ".isConst = true" "")
+            string(APPEND body "${code}")
+            math(EXPR id "${id} + 1")
+        endforeach()
+    endforeach()
+    set(${outVar} "${body}" PARENT_SCOPE)
+    set(${countVar} ${id} PARENT_SCOPE)
+endfunction()
+
+# traits_generate_compile_bench_sources(<outputDir> <variant> <prologue> <traitsTemplate> <sourcesVar>)
+#
+# Generates the benchmark translation units into <outputDir>, their names are prefixed with <variant>. <prologue> is
+# placed at the top of every unit and is what makes the library available (e.g. "#include <traits/functions.hpp>"),
+# <traitsTemplate> is the traits template that is used to inspect the signatures (e.g. "::Traits::FunctionTraits").
+# The list of generated files is stored in <sourcesVar>, the number of inspected signatures per file in
+# <sourcesVar>_SIGNATURES.
+function(traits_generate_compile_bench_sources outputDir variant prologue traitsTemplate sourcesVar)
+    set(TRAITS_BENCH_TRAITS_TEMPLATE "${traitsTemplate}")
+    file(MAKE_DIRECTORY "${outputDir}")
+    set(sources "")
+    set(signatures "")
+
+    _traits_bench_write("${outputDir}/${variant}_baseline.cpp" "${prologue}" "")
+    list(APPEND sources "${outputDir}/${variant}_baseline.cpp")
+    list(APPEND signatures 0)
+
+    foreach (unit qualifiers member_pointers arity lambdas)
+        if (unit STREQUAL "qualifiers")
+            _traits_bench_qualifiers_tu(body count)
+        elseif (unit STREQUAL "member_pointers")
+            _traits_bench_member_pointers_tu(body count)
+        elseif (unit STREQUAL "arity")
+            _traits_bench_arity_tu(body count)
+        else()
+            _traits_bench_lambdas_tu(body count)
+        endif()
+        _traits_bench_write("${outputDir}/${variant}_${unit}.cpp" "${prologue}" "${body}")
+        list(APPEND sources "${outputDir}/${variant}_${unit}.cpp")
+        list(APPEND signatures ${count})
+    endforeach()
+
+    set(${sourcesVar} "${sources}" PARENT_SCOPE)
+    set(${sourcesVar}_SIGNATURES "${signatures}" PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,192 @@
+# Runs the compile time benchmark. Invoked in script mode by the traits-compile-bench target:
+#
+#   cmake -DCOMPILER=... -DCOMPILER_ID=... -DCOMPILE_FLAGS=... -DSOURCES=... -DSIGNATURES=... -DOUTPUT_DIR=...
+#         [-DREPETITIONS=3] [-DTIME_EXECUTABLE=...] [-DBASELINE=<csv>] [-DTOLERANCE=<percent>]
+#         [-DMEASURED=... -DMEASURED_SIGNATURES=...]
+#         -P run_compile_bench.cmake
+#
+# Every translation unit is compiled REPETITIONS times and the fastest wall clock time is reported. Alongside the time,
+# the peak compiler memory and the template instantiation work are collected where the toolchain exposes them:
+#  - GNU time (TIME_EXECUTABLE) reports the maximum resident set size of the compiler.
+#  - Clang: -ftime-trace reports the number of class and function template instantiations.
+#  - GCC: -ftime-report reports the time spent in template instantiation and the GC heap usage (used as memory figure
+#    when GNU time is not available).
+# MEASURED lists translation units that were compiled by the build system through time_compile.cmake (module importers,
+# which need the BMI the build system produced). Only their wall clock time of the last build is available.
+# The results are printed and written to OUTPUT_DIR/compile_bench.csv. When a BASELINE report is given, the run fails
+# if the total time regresses by more than TOLERANCE percent or the instantiation count grows.
+
+cmake_minimum_required(VERSION 3.23)
+
+foreach (required COMPILER COMPILER_ID SOURCES OUTPUT_DIR)
+    if (NOT DEFINED ${required})
+        message(FATAL_ERROR "run_compile_bench.cmake: ${required} is not set")
+    endif()
+endforeach()
+
+if (NOT DEFINED REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+if (NOT DEFINED TOLERANCE)
+    set(TOLERANCE 10)
+endif()
+
+# Lists are passed with '|' separators so they survive the command line.
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+string(REPLACE "|" ";" SIGNATURES "${SIGNATURES}")
+string(REPLACE "|" ";" COMPILE_FLAGS "${COMPILE_FLAGS}")
+string(REPLACE "|" ";" MEASURED "${MEASURED}")
+string(REPLACE "|" ";" MEASURED_SIGNATURES "${MEASURED_SIGNATURES}")
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+function(_now_microseconds outVar)
+    string(TIMESTAMP now "%s%f" UTC)
+    set(${outVar} ${now} PARENT_SCOPE)
+endfunction()
+
+set(report "tu,signatures,wall_ms,memory_kb,instantiations,instantiation_ms\n")
+set(totalMs 0)
+set(totalInstantiations 0)
+set(haveInstantiations FALSE)
+
+message(STATUS "")
+message(STATUS "traits compile benchmark (${COMPILER_ID}, best of ${REPETITIONS})")
+
+set(index 0)
+foreach (source IN LISTS SOURCES)
+    get_filename_component(name "${source}" NAME_WE)
+    list(GET SIGNATURES ${index} signatureCount)
+    math(EXPR index "${index} + 1")
+
+    set(extraFlags "")
+    set(tracePath "${OUTPUT_DIR}/${name}.json")
+    if (COMPILER_ID STREQUAL "Clang")
+        set(extraFlags "-ftime-trace=${tracePath}" "-ftime-trace-granularity=0")
+    elseif (COMPILER_ID STREQUAL "GNU")
+        set(extraFlags "-ftime-report")
+    endif()
+
+    set(timePrefix "")
+    if (TIME_EXECUTABLE)
+        set(timePrefix "${TIME_EXECUTABLE}" "-f" "%M" "-o" "${OUTPUT_DIR}/${name}.mem")
+    endif()
+
+    set(bestMs "")
+    foreach (repetition RANGE 1 ${REPETITIONS})
+        _now_microseconds(start)
+        execute_process(
+            COMMAND ${timePrefix} "${COMPILER}" ${COMPILE_FLAGS} ${extraFlags} "${source}"
+            RESULT_VARIABLE result
+            OUTPUT_VARIABLE output
+            ERROR_VARIABLE errors
+        )
+        _now_microseconds(stop)
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Compiling ${source} failed:\n${output}${errors}")
+        endif()
+        math(EXPR elapsedMs "(${stop} - ${start}) / 1000")
+        if (bestMs STREQUAL "" OR elapsedMs LESS bestMs)
+            set(bestMs ${elapsedMs})
+            set(bestErrors "${errors}")
+        endif()
+    endforeach()
+    math(EXPR totalMs "${totalMs} + ${bestMs}")
+
+    set(memoryKb "n/a")
+    set(instantiations "n/a")
+    set(instantiationMs "n/a")
+
+    if (TIME_EXECUTABLE AND EXISTS "${OUTPUT_DIR}/${name}.mem")
+        file(STRINGS "${OUTPUT_DIR}/${name}.mem" memoryLines REGEX "^[0-9]+$")
+        if (memoryLines)
+            list(GET memoryLines -1 memoryKb)
+        endif()
+    endif()
+
+    if (COMPILER_ID STREQUAL "Clang" AND EXISTS "${tracePath}")
+        file(READ "${tracePath}" trace)
+        set(instantiations 0)
+        set(instantiationUs 0)
+        foreach (kind InstantiateClass InstantiateFunction)
+            if (trace MATCHES "\"dur\":([0-9]+),\"name\":\"Total ${kind}\",\"args\":{\"count\":([0-9]+)")
+                math(EXPR instantiationUs "${instantiationUs} + ${CMAKE_MATCH_1}")
+                math(EXPR instantiations "${instantiations} + ${CMAKE_MATCH_2}")
+            else()
+                string(REGEX MATCHALL "\"name\":\"${kind}\"" events "${trace}")
+                list(LENGTH events count)
+                math(EXPR instantiations "${instantiations} + ${count}")
+            endif()
+        endforeach()
+        math(EXPR instantiationMs "${instantiationUs} / 1000")
+        set(haveInstantiations TRUE)
+        math(EXPR totalInstantiations "${totalInstantiations} + ${instantiations}")
+    elseif (COMPILER_ID STREQUAL "GNU")
+        if (bestErrors MATCHES "template instantiation[ ]*:[^\n]*[ ]([0-9]+)\\.([0-9]+) \\([ 0-9]+%\\)[ ]+[0-9.]+[kMG]? \\(")
+            math(EXPR instantiationMs "${CMAKE_MATCH_1} * 1000 + ${CMAKE_MATCH_2} * 10")
+        endif()
+        if (memoryKb STREQUAL "n/a" AND bestErrors MATCHES "TOTAL[ ]*:[^\n]*[ ]([0-9]+)([kMG])")
+            set(memoryKb ${CMAKE_MATCH_1})
+            if (CMAKE_MATCH_2 STREQUAL "M")
+                math(EXPR memoryKb "${memoryKb} * 1024")
+            elseif (CMAKE_MATCH_2 STREQUAL "G")
+                math(EXPR memoryKb "${memoryKb} * 1024 * 1024")
+            endif()
+        endif()
+    endif()
+
+    string(APPEND report "${name},${signatureCount},${bestMs},${memoryKb},${instantiations},${instantiationMs}\n")
+
+    message(
+        STATUS
+        "  ${name}: signatures=${signatureCount} wall_ms=${bestMs} memory_kb=${memoryKb} "
+        "instantiations=${instantiations} instantiation_ms=${instantiationMs}"
+    )
+endforeach()
+
+set(index 0)
+foreach (source IN LISTS MEASURED)
+    get_filename_component(name "${source}" NAME_WE)
+    list(GET MEASURED_SIGNATURES ${index} signatureCount)
+    math(EXPR index "${index} + 1")
+
+    if (NOT EXISTS "${OUTPUT_DIR}/${name}.time")
+        message(WARNING "No timing for ${name}, was it compiled through time_compile.cmake?")
+        continue()
+    endif()
+    file(STRINGS "${OUTPUT_DIR}/${name}.time" measuredMs LIMIT_COUNT 1)
+
+    string(APPEND report "${name},${signatureCount},${measuredMs},n/a,n/a,n/a\n")
+    message(STATUS "  ${name}: signatures=${signatureCount} wall_ms=${measuredMs} (last build)")
+endforeach()
+
+if (haveInstantiations)
+    set(totalInstantiationsColumn ${totalInstantiations})
+else()
+    set(totalInstantiationsColumn "n/a")
+endif()
+string(APPEND report "total,,${totalMs},,${totalInstantiationsColumn},\n")
+file(WRITE "${OUTPUT_DIR}/compile_bench.csv" "${report}")
+
+message(STATUS "  total: wall_ms=${totalMs} instantiations=${totalInstantiationsColumn}")
+message(STATUS "  report: ${OUTPUT_DIR}/compile_bench.csv")
+
+if (BASELINE)
+    if (NOT EXISTS "${BASELINE}")
+        message(FATAL_ERROR "Baseline report ${BASELINE} does not exist")
+    endif()
+    file(STRINGS "${BASELINE}" baselineTotal REGEX "^total,")
+    string(REPLACE "," ";" baselineTotal "${baselineTotal}")
+    list(GET baselineTotal 2 baselineMs)
+    list(GET baselineTotal 4 baselineInstantiations)
+
+    math(EXPR allowedMs "${baselineMs} + ${baselineMs} * ${TOLERANCE} / 100")
+    message(STATUS "  baseline: wall_ms=${baselineMs} (allowed ${allowedMs}) instantiations=${baselineInstantiations}")
+    if (totalMs GREATER allowedMs)
+        message(FATAL_ERROR "Compile time regressed: ${totalMs} ms > ${allowedMs} ms")
+    endif()
+    if (haveInstantiations AND NOT baselineInstantiations STREQUAL "n/a" AND
+        totalInstantiations GREATER baselineInstantiations)
+        message(FATAL_ERROR "Template instantiations regressed: ${totalInstantiations} > ${baselineInstantiations}")
+    endif()
+endif()
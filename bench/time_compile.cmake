@@ -0,0 +1,45 @@
+# Compiler launcher that measures the wall clock time of a single compilation. Used for translation units that can
+# only be compiled by the build system itself, e.g. module importers that depend on a BMI:
+#
+#   set_target_properties(<target> PROPERTIES RULE_LAUNCH_COMPILE "cmake -DOUTPUT_DIR=<dir> -P time_compile.cmake --")
+#
+# The time is written to OUTPUT_DIR/<source name>.time and picked up by run_compile_bench.cmake.
+
+cmake_minimum_required(VERSION 3.23)
+
+set(command "")
+set(source "")
+set(collect FALSE)
+set(nextIsSource FALSE)
+math(EXPR lastArgument "${CMAKE_ARGC} - 1")
+foreach (index RANGE 1 ${lastArgument})
+    set(argument "${CMAKE_ARGV${index}}")
+    if (collect)
+        list(APPEND command "${argument}")
+        if (nextIsSource)
+            set(source "${argument}")
+            set(nextIsSource FALSE)
+        elseif (argument STREQUAL "-c")
+            set(nextIsSource TRUE)
+        elseif (argument MATCHES "\\.(cpp|cxx|cc)$")
+            set(source "${argument}")
+        endif()
+    elseif (argument STREQUAL "--")
+        set(collect TRUE)
+    endif()
+endforeach()
+
+string(TIMESTAMP start "%s%f" UTC)
+execute_process(COMMAND ${command} RESULT_VARIABLE result)
+string(TIMESTAMP stop "%s%f" UTC)
+
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Compilation failed: ${result}")
+endif()
+
+if (OUTPUT_DIR AND NOT source STREQUAL "")
+    get_filename_component(name "${source}" NAME_WE)
+    math(EXPR elapsedMs "(${stop} - ${start}) / 1000")
+    file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+    file(WRITE "${OUTPUT_DIR}/${name}.time" "${elapsedMs}\n")
+endif()
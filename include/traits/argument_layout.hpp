@@ -0,0 +1,81 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        constexpr std::size_t alignUp(std::size_t offset, std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        /**
+         * @brief The end of the first "count" types when they are laid out one after another, each at its natural
+         * alignment.
+         */
+        template <std::size_t count, typename... Ts>
+        constexpr std::size_t packedEnd() noexcept
+        {
+            std::size_t end = 0;
+            std::size_t index = 0;
+            ((index++ < count ? (end = alignUp(end, alignof(Ts)) + sizeof(Ts)) : end), ...);
+            return end;
+        }
+
+        /**
+         * @brief True for argument types that can be read from / written to a byte buffer: trivially copyable values
+         * and const references to them. Non const lvalue references are rejected, the callee could not write back.
+         */
+        template <typename ArgumentT>
+        concept IsBufferArgument = std::is_trivially_copyable_v<std::decay_t<ArgumentT>> &&
+            (!std::is_lvalue_reference_v<ArgumentT> || std::is_const_v<std::remove_reference_t<ArgumentT>>);
+    }
+
+    /**
+     * @brief Describes how the arguments of a function are laid out in a byte buffer: every argument is stored with its
+     * decayed type at its natural alignment, in order, without trailing padding. Everything is a compile time constant.
+     *
+     * @tparam Args The argument types of the function.
+     */
+    template <typename... Args>
+    struct ArgumentLayout
+    {
+        /// The number of arguments.
+        constexpr static std::size_t arity = sizeof...(Args);
+
+        /// True when all arguments can be read from a byte buffer, see invokeFromBuffer.
+        constexpr static bool isSupported = (Detail::IsBufferArgument<Args> && ...);
+
+        /// The size of the N-th argument in bytes.
+        template <std::size_t N>
+        constexpr static std::size_t size = sizeof(std::decay_t<PackElement<N, Args...>>);
+
+        /// The alignment of the N-th argument.
+        template <std::size_t N>
+        constexpr static std::size_t alignment = alignof(std::decay_t<PackElement<N, Args...>>);
+
+        /// The offset of the N-th argument from the start of the buffer.
+        template <std::size_t N>
+        constexpr static std::size_t offset =
+            Detail::alignUp(Detail::packedEnd<N, std::decay_t<Args>...>(), alignment<N>);
+
+        /// The number of bytes all arguments occupy, including the padding between them.
+        constexpr static std::size_t packedSize = Detail::packedEnd<arity, std::decay_t<Args>...>();
+
+        /// True when there are padding bytes between the arguments.
+        constexpr static bool hasPadding = packedSize != (std::size_t{0} + ... + sizeof(std::decay_t<Args>));
+    };
+
+    /**
+     * @brief The ArgumentLayout of a function.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using ArgumentLayoutOf = typename FunctionTraitsCore<FunctionT>::ArgsTypeList::template Apply<ArgumentLayout>;
+}
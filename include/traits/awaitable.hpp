@@ -0,0 +1,191 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/type_list.hpp>
+
+#include <concepts>
+#include <coroutine>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        template <typename T>
+        concept HasMemberCoAwait = requires(T&& value) { std::forward<T>(value).operator co_await(); };
+
+        template <typename T>
+        concept HasFreeCoAwait = requires(T&& value) { operator co_await(std::forward<T>(value)); };
+
+        /// The awaiter co_await uses for a value: the result of its operator co_await or the value itself.
+        template <typename T>
+        constexpr decltype(auto) getAwaiter(T&& value)
+        {
+            if constexpr (HasMemberCoAwait<T>)
+                return std::forward<T>(value).operator co_await();
+            else if constexpr (HasFreeCoAwait<T>)
+                return operator co_await(std::forward<T>(value));
+            else
+                return std::forward<T>(value);
+        }
+
+        template <typename T>
+        using AwaiterOf = decltype(getAwaiter(std::declval<T>()));
+
+        template <typename AwaiterT>
+        concept IsAwaiter = requires(AwaiterT& awaiter, std::coroutine_handle<> handle) {
+            { awaiter.await_ready() } -> std::convertible_to<bool>;
+            awaiter.await_suspend(handle);
+            awaiter.await_resume();
+        };
+
+        template <typename ReturnT, typename ArgsListT>
+        struct IsCoroutineSignature : std::false_type
+        {};
+
+        template <typename ReturnT, typename... Args>
+        requires requires { typename std::coroutine_traits<ReturnT, Args...>::promise_type; }
+        struct IsCoroutineSignature<ReturnT, TypeList<Args...>> : std::true_type
+        {};
+    }
+
+    /**
+     * @brief True for types that can be awaited in any coroutine: co_await on them yields an awaiter with
+     * await_ready, await_suspend and await_resume, directly or through an operator co_await.
+     *
+     * @tparam T The awaited type, a reference type awaits an lvalue.
+     */
+    template <typename T>
+    concept IsAwaitable = Detail::IsAwaiter<std::remove_reference_t<Detail::AwaiterOf<T>>>;
+
+    /**
+     * @brief The type co_await yields for an awaitable type, e.g. T for Task<T>.
+     */
+    template <IsAwaitable T>
+    using AwaitedType = decltype(std::declval<std::remove_reference_t<Detail::AwaiterOf<T>>&>().await_resume());
+
+    /**
+     * @brief True for functions returning a coroutine type, i.e. a type with a promise_type (see
+     * std::coroutine_traits). Whether the function body is a coroutine itself is not observable, for a caller the
+     * result behaves the same.
+     *
+     * @tparam FunctionT The function type, it needs FunctionTraits.
+     */
+    template <typename FunctionT>
+    concept IsCoroutine = Detail::IsCoroutineSignature<
+        typename FunctionTraitsCore<FunctionT>::ReturnType,
+        typename FunctionTraitsCore<FunctionT>::ArgsTypeList>::value;
+
+    namespace Detail
+    {
+        template <typename ReturnT>
+        struct AwaitResult
+        {
+            using type = ReturnT;
+        };
+
+        template <typename ReturnT>
+        requires IsAwaitable<ReturnT>
+        struct AwaitResult<ReturnT>
+        {
+            using type = AwaitedType<ReturnT>;
+        };
+    }
+
+    /**
+     * @brief The type co_await invokeAsync(function, ...) yields: the awaited type for functions returning an
+     * awaitable, the return type otherwise.
+     */
+    template <typename FunctionT>
+    using AwaitResultOf = typename Detail::AwaitResult<typename FunctionTraitsCore<FunctionT>::ReturnType>::type;
+
+    /**
+     * @brief An awaiter that is ready right away and yields a value, what invokeAsync returns for functions that do
+     * not return an awaitable. Awaiting it never suspends.
+     *
+     * @tparam ValueT The value type, may be a reference or void.
+     */
+    template <typename ValueT>
+    class ReadyAwaiter
+    {
+      public:
+        template <typename... Args>
+        constexpr explicit ReadyAwaiter(std::in_place_t, Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<ValueT, Args...>)
+            : value_(std::forward<Args>(args)...)
+        {}
+
+        constexpr bool await_ready() const noexcept
+        {
+            return true;
+        }
+
+        constexpr void await_suspend(std::coroutine_handle<>) const noexcept
+        {}
+
+        constexpr ValueT await_resume()
+        {
+            return std::forward<ValueT>(value_);
+        }
+
+      private:
+        ValueT value_;
+    };
+
+    template <>
+    class ReadyAwaiter<void>
+    {
+      public:
+        constexpr bool await_ready() const noexcept
+        {
+            return true;
+        }
+
+        constexpr void await_suspend(std::coroutine_handle<>) const noexcept
+        {}
+
+        constexpr void await_resume() const noexcept
+        {}
+    };
+
+    namespace Detail
+    {
+        /// Whether invokeAsync is noexcept: the call must not throw, and neither may moving a result that is not an
+        /// awaitable into its ReadyAwaiter.
+        template <typename FunctionT, typename... Args>
+        constexpr bool isNothrowInvokeAsync = std::is_nothrow_invocable_v<FunctionT, Args...> &&
+            (IsAwaitable<std::invoke_result_t<FunctionT, Args...>> ||
+             std::is_void_v<std::invoke_result_t<FunctionT, Args...>> ||
+             std::is_nothrow_move_constructible_v<std::invoke_result_t<FunctionT, Args...>>);
+    }
+
+    /**
+     * @brief Calls the function and returns something to co_await, chosen at compile time: the result itself when
+     * the function returns an awaitable (e.g. a Task), so it is awaited without any adapter, and a ReadyAwaiter
+     * holding the result otherwise, which never suspends. Either way co_await invokeAsync(function, args...) yields
+     * the final value and neither path allocates or type erases.
+     *
+     * @param function The function, synchronous or asynchronous.
+     * @param args The arguments, passed on as they are.
+     * @return The awaitable returned by the function or a ReadyAwaiter with its result.
+     */
+    template <typename FunctionT, typename... Args>
+    requires std::is_invocable_v<FunctionT, Args...>
+    constexpr decltype(auto) invokeAsync(FunctionT&& function, Args&&... args) noexcept(
+        Detail::isNothrowInvokeAsync<FunctionT, Args...>)
+    {
+        using ReturnType = std::invoke_result_t<FunctionT, Args...>;
+        if constexpr (IsAwaitable<ReturnType>)
+            return std::invoke(std::forward<FunctionT>(function), std::forward<Args>(args)...);
+        else if constexpr (std::is_void_v<ReturnType>)
+        {
+            std::invoke(std::forward<FunctionT>(function), std::forward<Args>(args)...);
+            return ReadyAwaiter<void>{};
+        }
+        else
+            return ReadyAwaiter<ReturnType>{
+                std::in_place, std::invoke(std::forward<FunctionT>(function), std::forward<Args>(args)...)};
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__)
+#    define TRAITS_LIB_RESTRICT __restrict
+#else
+#    define TRAITS_LIB_RESTRICT
+#endif
+
+namespace Traits
+{
+    namespace Detail
+    {
+        template <typename FunctionT, typename OutputT, typename... ColumnTs, std::size_t... Indices>
+        constexpr void checkBatchSignature(std::index_sequence<Indices...>) noexcept
+        {
+            using Core = FunctionTraitsCore<FunctionT>;
+            static_assert(!std::is_void_v<typename Core::ReturnType>, "invokeBatch requires a function with a result.");
+            static_assert(!std::is_const_v<OutputT>, "The output column must be writable.");
+            static_assert(
+                std::is_same_v<OutputT, std::remove_cvref_t<typename Core::ReturnType>>,
+                "The output column must have the return type of the function.");
+            static_assert(sizeof...(ColumnTs) == Core::arity, "There must be one input column per argument.");
+            static_assert(
+                (std::is_same_v<std::remove_cv_t<ColumnTs>, typename Core::template ArgumentDecayed<Indices>> && ...),
+                "Every input column must have the decayed type of the matching argument.");
+        }
+
+        /**
+         * @brief True when the memory of the output column overlaps the memory of the input column.
+         */
+        template <typename OutputT, typename ColumnT>
+        bool columnsOverlap(std::span<OutputT> output, std::span<ColumnT> column) noexcept
+        {
+            std::less<void const*> const before;
+            return before(output.data(), column.data() + column.size())
+                && before(column.data(), output.data() + output.size());
+        }
+
+        template <typename OutputT, typename... ColumnTs>
+        std::size_t checkBatchSizes(std::span<OutputT> output, std::span<ColumnTs>... columns)
+        {
+            if (((columns.size() != output.size()) || ...))
+                throw std::length_error("All columns of a batch must have the same length.");
+            assert(!(columnsOverlap(output, columns) || ...) && "The output column must not alias an input column.");
+            return output.size();
+        }
+
+        /**
+         * @brief The plain batch loop. The columns are passed as restrict qualified pointers so that the compiler knows
+         * that the output does not alias the inputs and can vectorize the loop when the function is inlined.
+         */
+        template <typename FunctionT, typename OutputT, typename... ColumnTs>
+        void invokeBatchLoop(
+            FunctionT& function,
+            std::size_t count,
+            OutputT* TRAITS_LIB_RESTRICT output,
+            ColumnTs const* TRAITS_LIB_RESTRICT... columns)
+        {
+            for (std::size_t row = 0; row < count; ++row)
+                output[row] = function(columns[row]...);
+        }
+
+        template <typename FunctionT, typename OutputT, typename... ColumnTs>
+        inline void invokeBatchRow(
+            FunctionT& function,
+            std::size_t row,
+            OutputT* TRAITS_LIB_RESTRICT output,
+            ColumnTs const* TRAITS_LIB_RESTRICT... columns)
+        {
+            output[row] = function(columns[row]...);
+        }
+
+        template <std::size_t... Lanes, typename FunctionT, typename OutputT, typename... ColumnTs>
+        inline void invokeBatchStrip(
+            std::index_sequence<Lanes...>,
+            FunctionT& function,
+            std::size_t row,
+            OutputT* TRAITS_LIB_RESTRICT output,
+            ColumnTs const* TRAITS_LIB_RESTRICT... columns)
+        {
+            (invokeBatchRow(function, row + Lanes, output, columns...), ...);
+        }
+
+        /**
+         * @brief The unrolled batch loop: the rows are processed in strips of "unroll" rows, every strip is expanded at
+         * compile time, the remaining rows are processed one by one.
+         */
+        template <std::size_t unroll, typename FunctionT, typename OutputT, typename... ColumnTs>
+        void invokeBatchUnrolledLoop(
+            FunctionT& function,
+            std::size_t count,
+            OutputT* TRAITS_LIB_RESTRICT output,
+            ColumnTs const* TRAITS_LIB_RESTRICT... columns)
+        {
+            std::size_t row = 0;
+            for (; row + unroll <= count; row += unroll)
+                invokeBatchStrip(std::make_index_sequence<unroll>{}, function, row, output, columns...);
+            for (; row < count; ++row)
+                output[row] = function(columns[row]...);
+        }
+    }
+
+    /**
+     * @brief Invokes a function once per row of the given columns and stores the results in the output column. The
+     * column types are checked against the decayed argument types and the output against the return type at compile
+     * time. The loop is free of aliasing between the output and the inputs, so the compiler can vectorize it when the
+     * function can be inlined (lambdas, function objects).
+     *
+     * @pre The output column does not overlap any input column, e.g. invokeBatch(f, x, x) is undefined behaviour. The
+     * columns are passed to the loop as restrict qualified pointers; debug builds assert this. Input columns may alias
+     * each other.
+     *
+     * @param function The function to invoke, it is invoked as lvalue.
+     * @param output The output column.
+     * @param columns One input column per argument of the function.
+     * @throws std::length_error when the columns do not all have the same length.
+     */
+    template <typename FunctionT, typename OutputT, typename... ColumnTs>
+    void invokeBatch(FunctionT&& function, std::span<OutputT> output, std::span<ColumnTs>... columns)
+    {
+        Detail::checkBatchSignature<std::remove_cvref_t<FunctionT>, OutputT, ColumnTs...>(
+            std::index_sequence_for<ColumnTs...>{});
+        auto const count = Detail::checkBatchSizes(output, columns...);
+        Detail::invokeBatchLoop(function, count, output.data(), static_cast<ColumnTs const*>(columns.data())...);
+    }
+
+    /**
+     * @brief Like invokeBatch, but processes the rows in strips of "unroll" rows that are expanded at compile time.
+     * This helps when the function can not be vectorized (e.g. it is too large to be inlined or contains branches),
+     * but independent calls can still be overlapped.
+     *
+     * @tparam unroll The number of rows per strip.
+     */
+    template <std::size_t unroll = 4, typename FunctionT, typename OutputT, typename... ColumnTs>
+    void invokeBatchUnrolled(FunctionT&& function, std::span<OutputT> output, std::span<ColumnTs>... columns)
+    {
+        static_assert(unroll > 0, "The unroll factor must be positive.");
+        Detail::checkBatchSignature<std::remove_cvref_t<FunctionT>, OutputT, ColumnTs...>(
+            std::index_sequence_for<ColumnTs...>{});
+        auto const count = Detail::checkBatchSizes(output, columns...);
+        Detail::invokeBatchUnrolledLoop<unroll>(
+            function, count, output.data(), static_cast<ColumnTs const*>(columns.data())...);
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <traits/argument_layout.hpp>
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        /**
+         * @brief Reads a trivially copyable value from a possibly unaligned position in a buffer.
+         */
+        template <typename T>
+        T loadArgument(std::byte const* source) noexcept
+        {
+            alignas(T) std::byte storage[sizeof(T)];
+            std::memcpy(storage, source, sizeof(T));
+            return *std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        template <typename FunctionT>
+        constexpr void checkBufferSignature() noexcept
+        {
+            static_assert(
+                !std::is_member_function_pointer_v<FunctionT>,
+                "Member function pointers can not be invoked from a buffer, bind the object in a lambda.");
+            static_assert(
+                ArgumentLayoutOf<FunctionT>::isSupported,
+                "All arguments must be trivially copyable values or const references to them.");
+        }
+
+        template <typename FunctionT, std::size_t... Indices>
+        decltype(auto) invokeFromBuffer(FunctionT&& function, std::byte const* data, std::index_sequence<Indices...>)
+        {
+            using Core = FunctionTraitsCore<std::remove_cvref_t<FunctionT>>;
+            using Layout = ArgumentLayoutOf<std::remove_cvref_t<FunctionT>>;
+            return std::forward<FunctionT>(function)(loadArgument<typename Core::template ArgumentDecayed<Indices>>(
+                data + Layout::template offset<Indices>)...);
+        }
+
+        template <typename FunctionT, typename... Args, std::size_t... Indices>
+        void packArgs(std::byte* data, std::index_sequence<Indices...>, Args&&... args)
+        {
+            using Core = FunctionTraitsCore<FunctionT>;
+            using Layout = ArgumentLayoutOf<FunctionT>;
+            if constexpr (Layout::hasPadding)
+                std::memset(data, 0, Layout::packedSize);
+            (
+                [&] {
+                    typename Core::template ArgumentDecayed<Indices> const value = std::forward<Args>(args);
+                    std::memcpy(data + Layout::template offset<Indices>, __builtin_addressof(value), sizeof(value));
+                }(),
+                ...);
+        }
+    }
+
+    /**
+     * @brief Invokes a function with arguments read straight from a byte buffer in the ArgumentLayout of the function,
+     * without an intermediate tuple or allocation. Signatures with arguments that are not trivially copyable are
+     * rejected at compile time.
+     *
+     * @param function The function to invoke.
+     * @param buffer The arguments as written by packArgs.
+     * @return The result of the function.
+     * @throws std::length_error when the buffer is smaller than ArgumentLayoutOf<F>::packedSize.
+     */
+    template <typename FunctionT>
+    decltype(auto) invokeFromBuffer(FunctionT&& function, std::span<std::byte const> buffer)
+    {
+        using FunctionType = std::remove_cvref_t<FunctionT>;
+        Detail::checkBufferSignature<FunctionType>();
+
+        using Layout = ArgumentLayoutOf<FunctionType>;
+        if (buffer.size() < Layout::packedSize)
+            throw std::length_error("The buffer is smaller than the arguments of the function.");
+
+        if constexpr (Layout::arity == 0)
+            return std::forward<FunctionT>(function)();
+        else
+            return Detail::invokeFromBuffer(
+                std::forward<FunctionT>(function), buffer.data(), std::make_index_sequence<Layout::arity>{});
+    }
+
+    /**
+     * @brief Writes the arguments for a function into a byte buffer in the ArgumentLayout of the function, so that
+     * invokeFromBuffer can read them. Every argument is converted to the decayed parameter type first, padding bytes
+     * are zeroed.
+     *
+     * @tparam FunctionT The type of the function the arguments are meant for.
+     * @param buffer The destination, at least ArgumentLayoutOf<FunctionT>::packedSize bytes large.
+     * @param args The arguments.
+     * @return std::size_t The number of bytes written.
+     * @throws std::length_error when the buffer is smaller than ArgumentLayoutOf<F>::packedSize.
+     */
+    template <typename FunctionT, typename... Args>
+    std::size_t packArgs(std::span<std::byte> buffer, Args&&... args)
+    {
+        using FunctionType = std::remove_cvref_t<FunctionT>;
+        Detail::checkBufferSignature<FunctionType>();
+
+        using Layout = ArgumentLayoutOf<FunctionType>;
+        static_assert(sizeof...(Args) == Layout::arity, "The number of arguments does not match the function.");
+        if (buffer.size() < Layout::packedSize)
+            throw std::length_error("The buffer is smaller than the arguments of the function.");
+
+        Detail::packArgs<FunctionType>(
+            buffer.data(), std::make_index_sequence<Layout::arity>{}, std::forward<Args>(args)...);
+        return Layout::packedSize;
+    }
+}
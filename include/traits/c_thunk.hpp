@@ -0,0 +1,84 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        template <typename SignatureT, bool isNoexcept>
+        struct ContextSignature;
+
+        template <typename ReturnT, typename... Args, bool isNoexcept>
+        struct ContextSignature<ReturnT(Args...), isNoexcept>
+        {
+            using type = ReturnT (*)(void*, Args...) noexcept(isNoexcept);
+        };
+
+        template <auto memberFunction, typename SignatureT>
+        struct CThunk;
+
+        /**
+         * @brief The trampoline behind makeCThunk: casts the context back to the (cv qualified) class and calls the
+         * member function on it, as rvalue for && qualified member functions.
+         */
+        template <auto memberFunction, typename ReturnT, typename... Args, bool isNoexcept>
+        struct CThunk<memberFunction, ReturnT(Args...) noexcept(isNoexcept)>
+        {
+            using MemberTraits = FunctionTraitsImpl<decltype(memberFunction)>;
+            using ClassType = std::conditional_t<
+                MemberTraits::qualifiers.isVolatile,
+                std::add_volatile_t<typename MemberTraits::ClassType>,
+                typename MemberTraits::ClassType>;
+            using QualifiedClassType =
+                std::conditional_t<MemberTraits::qualifiers.isConst, std::add_const_t<ClassType>, ClassType>;
+
+            static ReturnT invoke(void* context, Args... args) noexcept(isNoexcept)
+            {
+                auto* object = static_cast<QualifiedClassType*>(context);
+                if constexpr (MemberTraits::qualifiers.isRvalueReferenceQualified)
+                    return (std::move(*object).*memberFunction)(std::forward<Args>(args)...);
+                else
+                    return ((*object).*memberFunction)(std::forward<Args>(args)...);
+            }
+        };
+    }
+
+    /**
+     * @brief The C callback type for a member function: a function pointer taking the object as leading "void*
+     * context" followed by the arguments of the member function, keeping the noexcept qualifier. E.g.
+     * "int (*)(void*, double) noexcept" for "int (Class::*)(double) const noexcept".
+     *
+     * @tparam MemberFunctionT A member function pointer type.
+     */
+    template <typename MemberFunctionT>
+    requires Detail::IsMemberFunctionPointer<MemberFunctionT>
+    using CThunkOf = typename Detail::ContextSignature<
+        typename FunctionTraitsImpl<MemberFunctionT>::Signature,
+        FunctionTraitsImpl<MemberFunctionT>::qualifiers.isNoexcept>::type;
+
+    /**
+     * @brief Creates a trampoline for passing a member function to C libraries that take a callback together with a
+     * "void* context". The context must point to the object the member function is called on. cv and reference
+     * qualifiers of the member function are honoured, so const member functions never see a non const object and &&
+     * qualified ones are called on an rvalue. No state is allocated, the trampoline is a static function.
+     *
+     * @tparam memberFunction The member function, e.g. &Class::method.
+     * @return CThunkOf<decltype(memberFunction)> The trampoline.
+     */
+    template <auto memberFunction>
+    requires Detail::IsMemberFunctionPointer<decltype(memberFunction)>
+    constexpr CThunkOf<decltype(memberFunction)> makeCThunk() noexcept
+    {
+        using MemberTraits = FunctionTraitsImpl<decltype(memberFunction)>;
+        return &Detail::CThunk<
+            memberFunction,
+            typename Detail::QualifiedSignature<
+                typename MemberTraits::Signature,
+                false,
+                MemberTraits::qualifiers.isNoexcept>::type>::invoke;
+    }
+}
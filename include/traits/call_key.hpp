@@ -0,0 +1,135 @@
+#pragma once
+
+#include <traits/functions_tuple.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        template <typename T>
+        concept IsStringLike = std::is_convertible_v<T const&, std::string_view>;
+
+        /**
+         * @brief An argument as it is hashed and compared for a key element: string like arguments as
+         * std::string_view, which hashes equal to std::string, so looking them up does not allocate, other arguments
+         * converted to the key element type (not copied if they have that type already).
+         */
+        template <typename KeyElementT, typename ArgumentT>
+        decltype(auto) asKeyElement(ArgumentT const& argument)
+        {
+            if constexpr (IsStringLike<KeyElementT> && IsStringLike<ArgumentT>)
+                return std::string_view{argument};
+            else if constexpr (std::is_same_v<KeyElementT, ArgumentT>)
+                return (argument);
+            else
+                return static_cast<KeyElementT>(argument);
+        }
+
+        /**
+         * @brief Hashes an argument as if it was converted to the key element type first, see asKeyElement.
+         */
+        template <typename KeyElementT, typename ArgumentT>
+        std::size_t hashKeyElement(ArgumentT const& argument)
+        {
+            decltype(auto) element = asKeyElement<KeyElementT>(argument);
+            return std::hash<std::remove_cvref_t<decltype(element)>>{}(element);
+        }
+
+        /**
+         * @brief Transparent hash and equality for a key tuple, also accepting tuples of references to the arguments
+         * of a call, so that lookups do not need to construct the key.
+         */
+        template <typename KeyT>
+        struct KeyTupleHash
+        {
+            using is_transparent = void;
+
+            template <typename... Ts>
+            std::size_t operator()(std::tuple<Ts...> const& key) const
+            {
+                return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                    std::size_t hash = sizeof...(Ts);
+                    ((hash ^= hashKeyElement<std::tuple_element_t<Indices, KeyT>>(std::get<Indices>(key)) +
+                          0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2)),
+                     ...);
+                    return hash;
+                }(std::index_sequence_for<Ts...>{});
+            }
+        };
+
+        /// Keys own their strings: std::string_view arguments are stored as std::string.
+        template <typename T>
+        struct OwningKeyElement
+        {
+            using type = T;
+        };
+
+        template <typename CharT, typename TraitsT>
+        struct OwningKeyElement<std::basic_string_view<CharT, TraitsT>>
+        {
+            using type = std::basic_string<CharT, TraitsT>;
+        };
+
+        template <typename TupleT>
+        struct OwningKey;
+
+        template <typename... Ts>
+        struct OwningKey<std::tuple<Ts...>>
+        {
+            using type = std::tuple<typename OwningKeyElement<Ts>::type...>;
+        };
+
+        template <typename FunctionT, typename TupleT>
+        constexpr bool isInvocableWithElements = []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return std::is_invocable_v<FunctionT, decltype(std::get<Indices>(std::declval<TupleT>()))...>;
+        }(std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<TupleT>>>{});
+
+        /**
+         * @brief The equality matching KeyTupleHash: both sides are compared as if they were converted to the key
+         * element types first, so an argument finds the key it would have been stored under.
+         */
+        template <typename KeyT>
+        struct KeyTupleEqual
+        {
+            using is_transparent = void;
+
+            template <typename... Ls, typename... Rs>
+            bool operator()(std::tuple<Ls...> const& lhs, std::tuple<Rs...> const& rhs) const
+            {
+                return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                    return (
+                        (asKeyElement<std::tuple_element_t<Indices, KeyT>>(std::get<Indices>(lhs)) ==
+                         asKeyElement<std::tuple_element_t<Indices, KeyT>>(std::get<Indices>(rhs))) &&
+                        ...);
+                }(std::index_sequence_for<Ls...>{});
+            }
+        };
+
+        /// The key of a call: ArgsTupleDecayed with std::string_view stored as std::string.
+        template <typename FunctionT>
+        using CallKeyOf = typename OwningKey<ArgsTupleDecayedOf<FunctionT>>::type;
+
+        /**
+         * @brief Calls the function with the elements of a key. Parameters taking rvalues get a copy of the key.
+         */
+        template <typename FunctionT, typename KeyT>
+        decltype(auto) invokeWithKey(FunctionT const& function, KeyT const& key)
+        {
+            if constexpr (isInvocableWithElements<FunctionT const&, KeyT const&>)
+                return std::apply(function, key);
+            else
+            {
+                auto copy = key;
+                return std::apply(function, std::move(copy));
+            }
+        }
+    }
+}
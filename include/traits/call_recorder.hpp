@@ -0,0 +1,311 @@
+#pragma once
+
+/// 1 when the platform provides POSIX memory mapped files, the call recorder is only available then. Elsewhere (e.g.
+/// Windows) this header declares nothing, so it can be included unconditionally and the feature checked with this
+/// macro.
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#    define TRAITS_LIB_HAS_CALL_RECORDER 1
+#else
+#    define TRAITS_LIB_HAS_CALL_RECORDER 0
+#endif
+
+#if TRAITS_LIB_HAS_CALL_RECORDER
+
+#include <traits/argument_layout.hpp>
+#include <traits/buffer_invoke.hpp>
+#include <traits/functions_core.hpp>
+#include <traits/functions_tuple.hpp>
+#include <traits/signature_id.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        /// The start of a call log file, followed by recordCount records of recordSize bytes each.
+        struct CallLogHeader
+        {
+            constexpr static char expectedMagic[8] = {'T', 'R', 'C', 'A', 'L', 'L', 'S', '1'};
+
+            char magic[8];
+            /// Identifies the decayed argument types, replay rejects logs of other signatures.
+            std::uint64_t argumentsId;
+            std::uint64_t recordSize;
+            std::uint64_t recordCount;
+        };
+
+        /// The id of the decayed argument types of a function, independent of its return type and qualifiers.
+        template <typename FunctionT>
+        constexpr std::uint64_t callLogArgumentsId = typeHash<ArgsTupleDecayedOf<FunctionT>>();
+
+        [[noreturn]] inline void throwSystemError(char const* what)
+        {
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+
+        /**
+         * @brief A file descriptor and a shared memory mapping of the file, both released on destruction.
+         */
+        class MappedFile
+        {
+          public:
+            MappedFile(std::string const& path, int flags, std::size_t size)
+                : descriptor_{::open(path.c_str(), flags, 0644)}
+            {
+                if (descriptor_ < 0)
+                    throwSystemError("Can not open the call log");
+
+                if ((flags & O_CREAT) != 0)
+                {
+                    if (::ftruncate(descriptor_, static_cast<off_t>(size)) != 0)
+                        fail("Can not resize the call log");
+                }
+                else
+                {
+                    struct stat status;
+                    if (::fstat(descriptor_, &status) != 0)
+                        fail("Can not read the size of the call log");
+                    size = static_cast<std::size_t>(status.st_size);
+                }
+                if (size < sizeof(CallLogHeader))
+                {
+                    ::close(descriptor_);
+                    throw std::length_error("The call log is smaller than its header.");
+                }
+
+                auto const protection = (flags & O_ACCMODE) == O_RDONLY ? PROT_READ : PROT_READ | PROT_WRITE;
+                data_ = ::mmap(nullptr, size, protection, MAP_SHARED, descriptor_, 0);
+                if (data_ == MAP_FAILED)
+                    fail("Can not map the call log");
+                size_ = size;
+            }
+
+            MappedFile(MappedFile const&) = delete;
+            MappedFile& operator=(MappedFile const&) = delete;
+
+            ~MappedFile()
+            {
+                if (data_ != nullptr)
+                    ::munmap(data_, size_);
+                ::close(descriptor_);
+            }
+
+            std::byte* data() const noexcept
+            {
+                return static_cast<std::byte*>(data_);
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            /// Unmaps the file and cuts it to the given size.
+            void truncate(std::size_t size) noexcept
+            {
+                ::munmap(data_, size_);
+                data_ = nullptr;
+                size_ = 0;
+                [[maybe_unused]] auto const result = ::ftruncate(descriptor_, static_cast<off_t>(size));
+            }
+
+          private:
+            [[noreturn]] void fail(char const* what)
+            {
+                auto const error = errno;
+                ::close(descriptor_);
+                errno = error;
+                throwSystemError(what);
+            }
+
+          private:
+            int descriptor_;
+            void* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+    }
+
+    /**
+     * @brief The callable returned by recordCalls: appends the arguments of every call to a memory mapped log file
+     * and then calls the function. The log has a fixed capacity, every call reserves its record with one atomic
+     * increment, so any number of threads record concurrently without locks. Calls beyond the capacity are not
+     * recorded. The arguments are stored in the ArgumentLayout of the function (see packArgs), replay reads them back.
+     *
+     * @tparam FunctionT The recorded function, all its decayed arguments must be trivially copyable.
+     */
+    template <typename FunctionT>
+    class CallRecorder
+    {
+      private:
+        using Layout = ArgumentLayoutOf<FunctionT>;
+        constexpr static std::size_t recordSize = Layout::packedSize;
+
+      public:
+        /**
+         * @brief Creates (or overwrites) the log file with room for the given number of calls.
+         *
+         * @throws std::system_error when the file can not be created or mapped.
+         */
+        CallRecorder(FunctionT function, std::string const& path, std::size_t capacity)
+            : function_{std::move(function)}
+            , file_{path, O_RDWR | O_CREAT | O_TRUNC, sizeof(Detail::CallLogHeader) + capacity * recordSize}
+            , capacity_{capacity}
+        {
+            Detail::checkBufferSignature<FunctionT>();
+            Detail::CallLogHeader header{};
+            std::memcpy(header.magic, Detail::CallLogHeader::expectedMagic, sizeof(header.magic));
+            header.argumentsId = Detail::callLogArgumentsId<FunctionT>;
+            header.recordSize = recordSize;
+            std::memcpy(file_.data(), &header, sizeof(header));
+        }
+
+        CallRecorder(CallRecorder const&) = delete;
+        CallRecorder& operator=(CallRecorder const&) = delete;
+
+        /**
+         * @brief Writes the number of recorded calls and cuts the file to them. No thread may be recording anymore.
+         */
+        ~CallRecorder()
+        {
+            auto const count = recorded();
+            std::uint64_t const recordCount = count;
+            std::memcpy(file_.data() + offsetof(Detail::CallLogHeader, recordCount), &recordCount, sizeof(recordCount));
+            file_.truncate(sizeof(Detail::CallLogHeader) + count * recordSize);
+        }
+
+        /**
+         * @brief Records the arguments and calls the function with them.
+         */
+        template <typename... Args>
+        requires(sizeof...(Args) == Layout::arity && std::is_invocable_v<FunctionT const&, Args...>)
+        decltype(auto) operator()(Args&&... args) const
+        {
+            record(args...);
+            return std::invoke(function_, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Records the arguments without calling the function.
+         *
+         * @return false if the log is full.
+         */
+        template <typename... Args>
+        requires(sizeof...(Args) == Layout::arity)
+        bool record(Args const&... args) const
+        {
+            auto const index = next_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= capacity_)
+                return false;
+            auto* record = file_.data() + sizeof(Detail::CallLogHeader) + index * recordSize;
+            packArgs<FunctionT>(std::span<std::byte>{record, recordSize}, args...);
+            return true;
+        }
+
+        /**
+         * @brief The number of recorded calls.
+         */
+        std::size_t recorded() const noexcept
+        {
+            return std::min<std::size_t>(next_.load(std::memory_order_relaxed), capacity_);
+        }
+
+        /**
+         * @brief The number of calls that were not recorded because the log was full.
+         */
+        std::size_t dropped() const noexcept
+        {
+            auto const next = next_.load(std::memory_order_relaxed);
+            return next > capacity_ ? next - capacity_ : 0;
+        }
+
+      private:
+        FunctionT function_;
+        Detail::MappedFile file_;
+        std::size_t capacity_;
+        mutable std::atomic<std::size_t> next_{0};
+    };
+
+    /**
+     * @brief Wraps a function so that the arguments of its calls are recorded to a log file, see CallRecorder.
+     *
+     * @param function The function to record, it is shared between the recording threads.
+     * @param path The log file, it is created or overwritten.
+     * @param capacity The maximum number of recorded calls, the file is sized for them up front.
+     * @return CallRecorder<F> The recording function.
+     */
+    template <typename FunctionT>
+    CallRecorder<std::decay_t<FunctionT>> recordCalls(
+        FunctionT&& function, std::string const& path, std::size_t capacity)
+    {
+        return CallRecorder<std::decay_t<FunctionT>>{std::forward<FunctionT>(function), path, capacity};
+    }
+
+    /**
+     * @brief The outcome of replay.
+     */
+    struct ReplayResult
+    {
+        std::size_t calls = 0;
+        std::chrono::nanoseconds elapsed{0};
+    };
+
+    /**
+     * @brief Calls the function once for every record of a log written by CallRecorder, in the recorded order. The
+     * log is memory mapped and the arguments are read straight from it, so the measured time is dominated by the
+     * function.
+     *
+     * @param function A function with the same decayed argument types as the recorded one.
+     * @param path The log file.
+     * @return ReplayResult The number of calls and the time they took.
+     * @throws std::system_error when the file can not be opened or mapped.
+     * @throws std::runtime_error when the file is not a call log or was recorded for other argument types.
+     * @throws std::length_error when the file is shorter than its records.
+     */
+    template <typename FunctionT>
+    ReplayResult replay(FunctionT&& function, std::string const& path)
+    {
+        using FunctionType = std::remove_cvref_t<FunctionT>;
+        Detail::checkBufferSignature<FunctionType>();
+
+        Detail::MappedFile const file{path, O_RDONLY, 0};
+        Detail::CallLogHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, Detail::CallLogHeader::expectedMagic, sizeof(header.magic)) != 0)
+            throw std::runtime_error("The file is not a call log.");
+        if (header.argumentsId != Detail::callLogArgumentsId<FunctionType> ||
+            header.recordSize != ArgumentLayoutOf<FunctionType>::packedSize)
+            throw std::runtime_error("The call log was recorded for a function with other argument types.");
+        if (header.recordSize != 0 && (file.size() - sizeof(header)) / header.recordSize < header.recordCount)
+            throw std::length_error("The call log is shorter than its records.");
+
+        auto const* records = file.data() + sizeof(header);
+        auto const start = std::chrono::steady_clock::now();
+        for (std::uint64_t index = 0; index != header.recordCount; ++index)
+            invokeFromBuffer(function, std::span{records + index * header.recordSize, header.recordSize});
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        return ReplayResult{
+            .calls = static_cast<std::size_t>(header.recordCount),
+            .elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)};
+    }
+}
+
+#endif
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <traits/call_key.hpp>
+#include <traits/functions_core.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        /// The result of one in-flight call, empty for void functions.
+        template <typename ValueT>
+        struct FlightResult
+        {
+            std::optional<ValueT> value;
+
+            template <typename FunctionT, typename KeyT>
+            void compute(FunctionT const& function, KeyT const& key)
+            {
+                value.emplace(invokeWithKey(function, key));
+            }
+        };
+
+        template <>
+        struct FlightResult<void>
+        {
+            template <typename FunctionT, typename KeyT>
+            void compute(FunctionT const& function, KeyT const& key)
+            {
+                invokeWithKey(function, key);
+            }
+        };
+
+        /// The exception of one in-flight call, only present when the function may throw.
+        template <bool isNoexcept>
+        struct FlightException
+        {
+            std::exception_ptr exception;
+
+            void rethrow() const
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+        };
+
+        template <>
+        struct FlightException<true>
+        {
+            void rethrow() const noexcept
+            {}
+        };
+
+        /**
+         * @brief One in-flight call. It lives on the stack of the leader (the caller executing the function), the
+         * other callers with the same key wait on the done flag, copy the result and then leave.
+         */
+        template <typename ValueT, bool isNoexcept>
+        struct Flight
+        {
+            FlightResult<ValueT> result;
+            [[no_unique_address]] FlightException<isNoexcept> error;
+            std::atomic<std::uint32_t> done{0};
+            std::atomic<std::uint32_t> waiters{0};
+        };
+    }
+
+    /**
+     * @brief The callable returned by coalesce: concurrent calls with equal keys (the decayed arguments, see
+     * ArgsTupleDecayed) share one execution of the function. Results are not cached, a call that starts after the
+     * shared execution finished executes the function again.
+     *
+     * @tparam FunctionT The coalesced function.
+     */
+    template <typename FunctionT>
+    class Coalesced
+    {
+      public:
+        using KeyType = Detail::CallKeyOf<FunctionT>;
+        using ValueType = std::remove_cvref_t<typename FunctionTraitsCore<FunctionT>::ReturnType>;
+
+        /// Whether exceptions of the function are passed on to the waiting callers.
+        constexpr static bool isNoexcept = FunctionTraitsCore<FunctionT>::qualifiers.isNoexcept;
+
+        Coalesced(FunctionT function, std::size_t shardCount)
+            : function_{std::move(function)}
+            , shardCount_{std::max<std::size_t>(shardCount, 1)}
+            , shards_{std::make_unique<Shard[]>(shardCount_)}
+        {}
+
+        /**
+         * @brief Executes the function, or waits for the execution with an equal key that is already in flight and
+         * returns (or throws) its result. Arguments are looked up without constructing the key.
+         */
+        template <typename... Args>
+        requires std::is_constructible_v<KeyType, Args const&...>
+        ValueType operator()(Args const&... args) const
+        {
+            auto const lookup = std::forward_as_tuple(args...);
+            auto const hash = Detail::KeyTupleHash<KeyType>{}(lookup);
+            auto& shard = shards_[(hash ^ (hash >> 29)) % shardCount_];
+
+            std::unique_lock lock{shard.mutex};
+            if (auto iterator = shard.flights.find(lookup); iterator != shard.flights.end())
+            {
+                FlightType& flight = *iterator->second;
+                // Registered under the lock, the leader does not leave before all registered waiters are gone.
+                flight.waiters.fetch_add(1, std::memory_order_relaxed);
+                lock.unlock();
+                return wait(shard, flight);
+            }
+
+            FlightType flight;
+            auto const& key = shard.flights.try_emplace(std::make_from_tuple<KeyType>(lookup), &flight).first->first;
+            lock.unlock();
+            return lead(shard, flight, key);
+        }
+
+        /**
+         * @brief The number of calls currently in flight.
+         */
+        std::size_t inFlight() const
+        {
+            std::size_t count = 0;
+            for (std::size_t index = 0; index != shardCount_; ++index)
+            {
+                std::lock_guard lock{shards_[index].mutex};
+                count += shards_[index].flights.size();
+            }
+            return count;
+        }
+
+        /**
+         * @brief The number of callers waiting for a call in flight, those that joined an execution instead of leading
+         * it.
+         */
+        std::size_t waiting() const
+        {
+            std::size_t count = 0;
+            for (std::size_t index = 0; index != shardCount_; ++index)
+            {
+                std::lock_guard lock{shards_[index].mutex};
+                for (auto const& [key, flight] : shards_[index].flights)
+                    count += flight->waiters.load(std::memory_order_relaxed);
+            }
+            return count;
+        }
+
+      private:
+        using FlightType = Detail::Flight<ValueType, isNoexcept>;
+
+        struct Shard
+        {
+            using Map =
+                std::unordered_map<KeyType, FlightType*, Detail::KeyTupleHash<KeyType>, Detail::KeyTupleEqual<KeyType>>;
+
+            mutable std::mutex mutex;
+            Map flights;
+        };
+
+        ValueType lead(Shard& shard, FlightType& flight, KeyType const& key) const
+        {
+            // The key in the map stays valid until the flight is erased below: other callers may rehash the map, which
+            // invalidates iterators but not references to the elements.
+            if constexpr (isNoexcept)
+                flight.result.compute(function_, key);
+            else
+            {
+                try
+                {
+                    flight.result.compute(function_, key);
+                }
+                catch (...)
+                {
+                    flight.error.exception = std::current_exception();
+                }
+            }
+
+            {
+                // Later callers start a new flight, the waiting ones are registered already.
+                std::lock_guard lock{shard.mutex};
+                shard.flights.erase(shard.flights.find(key));
+            }
+            flight.done.store(1, std::memory_order_release);
+            flight.done.notify_all();
+
+            for (auto waiters = flight.waiters.load(std::memory_order_acquire); waiters != 0;
+                 waiters = flight.waiters.load(std::memory_order_acquire))
+                flight.waiters.wait(waiters, std::memory_order_acquire);
+            {
+                // The last waiter notifies while holding the lock, so the flight may only be destroyed once the lock
+                // is free again.
+                std::lock_guard lock{shard.mutex};
+            }
+
+            flight.error.rethrow();
+            if constexpr (!std::is_void_v<ValueType>)
+                return *std::move(flight.result.value);
+        }
+
+        ValueType wait(Shard& shard, FlightType& flight) const
+        {
+            while (flight.done.load(std::memory_order_acquire) == 0)
+                flight.done.wait(0, std::memory_order_acquire);
+
+            // Leaves once the result is copied, also when copying it throws.
+            struct Leave
+            {
+                Shard& shard;
+                FlightType& flight;
+
+                ~Leave()
+                {
+                    std::lock_guard lock{shard.mutex};
+                    if (flight.waiters.fetch_sub(1, std::memory_order_release) == 1)
+                        flight.waiters.notify_one();
+                }
+            } leave{shard, flight};
+
+            flight.error.rethrow();
+            if constexpr (!std::is_void_v<ValueType>)
+                return *flight.result.value;
+        }
+
+      private:
+        FunctionT function_;
+        std::size_t shardCount_;
+        std::unique_ptr<Shard[]> shards_;
+    };
+
+    /**
+     * @brief Wraps a function so that concurrent calls with equal decayed arguments (see ArgsTupleDecayed) share one
+     * execution ("single flight"), e.g. to avoid stampedes on cache misses. Waiting callers block on an atomic wait,
+     * nothing is allocated besides the map entry of the key. Exceptions are passed on to all waiting callers unless
+     * the function is noexcept, in which case no exception handling is compiled in.
+     *
+     * @param function The function to coalesce, it must be callable as const since it is shared between threads.
+     * @param shardCount The number of independently locked maps of in-flight calls.
+     * @return Coalesced<F> The coalesced function.
+     */
+    template <typename FunctionT>
+    Coalesced<std::decay_t<FunctionT>> coalesce(FunctionT&& function, std::size_t shardCount = 16)
+    {
+        using FunctionType = std::decay_t<FunctionT>;
+        static_assert(
+            FunctionTraitsCore<FunctionType>::qualifiers.isConst || !Detail::IsFunctionObject<FunctionType>,
+            "coalesce requires a const callable, the function is shared between threads.");
+        return Coalesced<std::decay_t<FunctionT>>{std::forward<FunctionT>(function), shardCount};
+    }
+}
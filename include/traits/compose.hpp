@@ -0,0 +1,245 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/type_list.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    template <typename... StageTs>
+    class Composed;
+
+    namespace Detail
+    {
+        /// The traits of a stage that receives the result of the previous stage. Stages FunctionTraitsCore can not
+        /// inspect (e.g. generic lambdas) are inspected with FunctionTraitsFor the input type.
+        template <typename StageT, typename InputT>
+        struct StageTraits
+        {
+            using type = FunctionTraitsFor<StageT, InputT>;
+        };
+
+        template <typename StageT, typename InputT>
+        requires HasFunctionTraits<StageT>
+        struct StageTraits<StageT, InputT>
+        {
+            using type = FunctionTraitsCore<StageT>;
+        };
+
+        /// Whether a stage can be called through a const reference.
+        template <typename StageT, typename TraitsT>
+        constexpr bool isConstStage = !IsFunctionObject<StageT> || TraitsT::qualifiers.isConst;
+
+        /**
+         * @brief Checks that every stage takes exactly one argument that the result of the previous stage converts
+         * to, and combines the traits of all stages.
+         *
+         * @tparam InputT The result type of the previous stage.
+         * @tparam StageTs The remaining stages.
+         */
+        template <typename InputT, typename... StageTs>
+        struct PipelineTraits
+        {
+            using ReturnType = InputT;
+            constexpr static bool isNoexcept = true;
+            constexpr static bool isConst = true;
+        };
+
+        template <typename InputT, typename StageT, typename... StageTs>
+        struct PipelineTraits<InputT, StageT, StageTs...>
+        {
+          private:
+            static_assert(!std::is_void_v<InputT>, "Only the last stage of a composition may return void.");
+
+            using Traits = typename StageTraits<StageT, InputT>::type;
+            static_assert(Traits::arity == 1, "Every stage after the first one must take exactly one argument.");
+            static_assert(
+                std::is_convertible_v<InputT, typename Traits::template Argument<0>>,
+                "The result of a stage does not convert to the argument of the next stage.");
+
+            using Next = PipelineTraits<typename Traits::ReturnType, StageTs...>;
+
+          public:
+            using ReturnType = typename Next::ReturnType;
+            constexpr static bool isNoexcept = Traits::qualifiers.isNoexcept && Next::isNoexcept;
+            constexpr static bool isConst = isConstStage<StageT, Traits> && Next::isConst;
+        };
+
+        template <typename FirstT, typename... StageTs>
+        struct ComposedTraits
+        {
+            static_assert(
+                HasFunctionTraits<FirstT>,
+                "The first stage of a composition must have a unique signature, e.g. not be a generic lambda.");
+
+            using First = FunctionTraitsCore<FirstT>;
+            using Rest = PipelineTraits<typename First::ReturnType, StageTs...>;
+
+            using ArgsTypeList = typename First::ArgsTypeList;
+            using ReturnType = typename Rest::ReturnType;
+            constexpr static bool isNoexcept = First::qualifiers.isNoexcept && Rest::isNoexcept;
+            constexpr static bool isConst = isConstStage<FirstT, First> && Rest::isConst;
+        };
+
+        /**
+         * @brief Calls the stages starting at index with the value, every intermediate result is passed on as an
+         * rvalue (moved or elided, never copied).
+         */
+        template <std::size_t index, typename StagesT, typename ValueT>
+        constexpr decltype(auto) invokeStages(StagesT& stages, ValueT&& value)
+        {
+            if constexpr (index + 1 == std::tuple_size_v<std::remove_const_t<StagesT>>)
+                return std::invoke(std::get<index>(stages), std::forward<ValueT>(value));
+            else
+                return invokeStages<index + 1>(
+                    stages, std::invoke(std::get<index>(stages), std::forward<ValueT>(value)));
+        }
+
+        template <typename StagesT, typename... Args>
+        constexpr decltype(auto) invokeComposed(StagesT& stages, Args&&... args)
+        {
+            if constexpr (std::tuple_size_v<std::remove_const_t<StagesT>> == 1)
+                return std::invoke(std::get<0>(stages), std::forward<Args>(args)...);
+            else
+                return invokeStages<1>(stages, std::invoke(std::get<0>(stages), std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief The implementation of Composed. The call operator has the exact parameters of the first stage, so
+         * that FunctionTraits of the composition work, it is const when all stages can be called as const and
+         * noexcept when all stages are noexcept.
+         */
+        template <typename ArgsListT, bool isConst, typename... StageTs>
+        class ComposedImpl;
+
+        template <typename... Args, typename... StageTs>
+        class ComposedImpl<TypeList<Args...>, true, StageTs...>
+        {
+          private:
+            using Traits = ComposedTraits<StageTs...>;
+
+          public:
+            constexpr explicit ComposedImpl(std::tuple<StageTs...> stages)
+                : stages_{std::move(stages)}
+            {}
+
+            constexpr typename Traits::ReturnType operator()(Args... args) const noexcept(Traits::isNoexcept)
+            {
+                return invokeComposed(stages_, std::forward<Args>(args)...);
+            }
+
+            /// The stages, e.g. to append more of them.
+            constexpr std::tuple<StageTs...> const& stages() const& noexcept
+            {
+                return stages_;
+            }
+
+            constexpr std::tuple<StageTs...>&& stages() && noexcept
+            {
+                return std::move(stages_);
+            }
+
+          private:
+            std::tuple<StageTs...> stages_;
+        };
+
+        template <typename... Args, typename... StageTs>
+        class ComposedImpl<TypeList<Args...>, false, StageTs...>
+        {
+          private:
+            using Traits = ComposedTraits<StageTs...>;
+
+          public:
+            constexpr explicit ComposedImpl(std::tuple<StageTs...> stages)
+                : stages_{std::move(stages)}
+            {}
+
+            constexpr typename Traits::ReturnType operator()(Args... args) noexcept(Traits::isNoexcept)
+            {
+                return invokeComposed(stages_, std::forward<Args>(args)...);
+            }
+
+            /// The stages, e.g. to append more of them.
+            constexpr std::tuple<StageTs...> const& stages() const& noexcept
+            {
+                return stages_;
+            }
+
+            constexpr std::tuple<StageTs...>&& stages() && noexcept
+            {
+                return std::move(stages_);
+            }
+
+          private:
+            std::tuple<StageTs...> stages_;
+        };
+
+        template <typename... StageTs>
+        using ComposedImplOf = ComposedImpl<
+            typename ComposedTraits<StageTs...>::ArgsTypeList,
+            ComposedTraits<StageTs...>::isConst,
+            StageTs...>;
+    }
+
+    /**
+     * @brief The callable returned by compose: calls the stages one after another, every stage receives the result of
+     * the previous one. It has a single, non template call operator with the parameters of the first stage, so
+     * FunctionTraits see the arity of the first stage, the return type of the last stage and noexcept when all stages
+     * are noexcept.
+     *
+     * @tparam StageTs The stages.
+     */
+    template <typename... StageTs>
+    class Composed : public Detail::ComposedImplOf<StageTs...>
+    {
+      private:
+        using Impl = Detail::ComposedImplOf<StageTs...>;
+
+      public:
+        using Impl::Impl;
+    };
+
+    /**
+     * @brief Composes functions into one callable: compose(f, g, h)(x) is h(g(f(x))). Fails to compile if a result
+     * does not convert to the single argument of the next stage. Intermediate results are moved into the next stage,
+     * all calls can be inlined.
+     *
+     * @param stages The functions, the first one must have a unique signature (FunctionTraits), the others take
+     * exactly one argument.
+     * @return Composed The composed function.
+     */
+    template <typename... StageTs>
+    requires(sizeof...(StageTs) > 0)
+    constexpr Composed<std::decay_t<StageTs>...> compose(StageTs&&... stages)
+    {
+        using Stages = std::tuple<std::decay_t<StageTs>...>;
+        return Composed<std::decay_t<StageTs>...>{Stages{std::forward<StageTs>(stages)...}};
+    }
+
+    /**
+     * @brief Appends a stage to a composition: compose(f) | g | h is compose(f, g, h).
+     */
+    template <typename... StageTs, typename StageT>
+    constexpr Composed<StageTs..., std::decay_t<StageT>> operator|(Composed<StageTs...> composed, StageT&& stage)
+    {
+        using Stage = std::tuple<std::decay_t<StageT>>;
+        return Composed<StageTs..., std::decay_t<StageT>>{
+            std::tuple_cat(std::move(composed).stages(), Stage{std::forward<StageT>(stage)})};
+    }
+
+    /**
+     * @brief Concatenates two compositions.
+     */
+    template <typename... StageTs, typename... OtherStageTs>
+    constexpr Composed<StageTs..., OtherStageTs...> operator|(
+        Composed<StageTs...> composed, Composed<OtherStageTs...> other)
+    {
+        return Composed<StageTs..., OtherStageTs...>{
+            std::tuple_cat(std::move(composed).stages(), std::move(other).stages())};
+    }
+}
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/thread_pool.hpp>
+#include <traits/type_list.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    /**
+     * @brief Stands in for the result of a Dataflow stage that returns void.
+     */
+    struct NoResult
+    {};
+
+    namespace Detail
+    {
+        /// The value a stage produces, void becomes NoResult and references are stored as values.
+        template <typename ReturnT>
+        using DataflowValue = std::conditional_t<std::is_void_v<ReturnT>, NoResult, std::remove_cvref_t<ReturnT>>;
+
+        template <typename StageT>
+        using DataflowValueOf = DataflowValue<typename FunctionTraitsCore<StageT>::ReturnType>;
+
+        /// Arguments are shared between the stages that consume them, so they are taken by value or const reference.
+        template <typename ArgumentT>
+        constexpr bool isDataflowArgument =
+            !std::is_rvalue_reference_v<ArgumentT> &&
+            (!std::is_lvalue_reference_v<ArgumentT> || std::is_const_v<std::remove_reference_t<ArgumentT>>);
+
+        /**
+         * @brief The dependency graph of the stages, built at compile time: every argument of a stage is produced by
+         * the one stage (or input) whose decayed result type equals the decayed argument type.
+         *
+         * @tparam InputListT The types of the external inputs, as a TypeList.
+         * @tparam StageTs The stages.
+         */
+        template <typename InputListT, typename... StageTs>
+        struct DataflowGraph;
+
+        template <typename... Inputs, typename... StageTs>
+        struct DataflowGraph<TypeList<Inputs...>, StageTs...>
+        {
+            constexpr static std::size_t stageCount = sizeof...(StageTs);
+
+            template <typename T>
+            constexpr static std::size_t producerCount =
+                (std::size_t{0} + ... + std::is_same_v<T, DataflowValueOf<StageTs>>) +
+                (std::size_t{0} + ... + std::is_same_v<T, std::decay_t<Inputs>>);
+
+            /// The index of the producer of a type: the stages come first, then the inputs.
+            template <typename T>
+            constexpr static std::size_t producerOf = [] {
+                constexpr std::array<bool, stageCount + sizeof...(Inputs)> matches{
+                    std::is_same_v<T, DataflowValueOf<StageTs>>..., std::is_same_v<T, std::decay_t<Inputs>>...};
+                std::size_t index = 0;
+                while (!matches[index])
+                    ++index;
+                return index;
+            }();
+
+            template <std::size_t stage>
+            using Stage = FunctionTraitsCore<PackElement<stage, StageTs...>>;
+
+            /// The index of the product the argument of the stage is taken from.
+            template <std::size_t stage, std::size_t argument>
+            constexpr static std::size_t producer = [] {
+                using ArgumentType = typename Stage<stage>::template Argument<argument>;
+                using ValueType = std::decay_t<ArgumentType>;
+                static_assert(
+                    isDataflowArgument<ArgumentType>,
+                    "Dataflow stages take their arguments by value or const reference, they are shared.");
+                static_assert(producerCount<ValueType> != 0, "No stage or input produces an argument of a stage.");
+                static_assert(
+                    producerCount<ValueType> == 1,
+                    "Several stages or inputs produce the type of an argument, the dependency is ambiguous.");
+                return producerOf<ValueType>;
+            }();
+
+            using Matrix = std::array<std::array<bool, stageCount>, stageCount>;
+
+            template <std::size_t stage, std::size_t... arguments>
+            constexpr static void addDependencies(Matrix& matrix, std::index_sequence<arguments...>)
+            {
+                ((producer<stage, arguments> < stageCount ? void(matrix[stage][producer<stage, arguments>] = true)
+                                                          : void()),
+                 ...);
+            }
+
+            template <std::size_t... stages>
+            constexpr static Matrix makeDependencies(std::index_sequence<stages...>)
+            {
+                Matrix matrix{};
+                (addDependencies<stages>(matrix, std::make_index_sequence<Stage<stages>::arity>{}), ...);
+                return matrix;
+            }
+
+            /// dependencies[stage][other] is true when the stage consumes the result of the other stage.
+            constexpr static Matrix dependencies = makeDependencies(std::make_index_sequence<stageCount>{});
+
+            /// The number of stages each stage waits for.
+            constexpr static std::array<std::size_t, stageCount> dependencyCounts = [] {
+                std::array<std::size_t, stageCount> counts{};
+                for (std::size_t stage = 0; stage != stageCount; ++stage)
+                    for (std::size_t other = 0; other != stageCount; ++other)
+                        counts[stage] += dependencies[stage][other] ? 1 : 0;
+                return counts;
+            }();
+
+            /// True when the stages can be ordered so that every stage runs after its dependencies (Kahn's algorithm).
+            constexpr static bool isAcyclic = [] {
+                auto counts = dependencyCounts;
+                std::array<bool, stageCount> done{};
+                for (std::size_t ordered = 0; ordered != stageCount; ++ordered)
+                {
+                    std::size_t ready = 0;
+                    while (ready != stageCount && (done[ready] || counts[ready] != 0))
+                        ++ready;
+                    if (ready == stageCount)
+                        return false;
+                    done[ready] = true;
+                    for (std::size_t stage = 0; stage != stageCount; ++stage)
+                        counts[stage] -= dependencies[stage][ready] ? 1 : 0;
+                }
+                return true;
+            }();
+        };
+
+        /**
+         * @brief The state of one Dataflow::run, it lives on the stack of the caller. Every stage counts down the
+         * dependency counters of the stages consuming its result and starts those that become ready.
+         */
+        template <typename GraphT, typename StagesT, typename InputsT>
+        struct DataflowRun;
+
+        template <typename GraphT, typename... StageTs, typename... Inputs>
+        struct DataflowRun<GraphT, std::tuple<StageTs...>, std::tuple<Inputs...>>
+        {
+            constexpr static std::size_t stageCount = sizeof...(StageTs);
+            constexpr static bool isNoexcept = (FunctionTraitsCore<StageTs>::qualifiers.isNoexcept && ...);
+
+            using RunnerType = void (*)(DataflowRun&) noexcept;
+
+            std::tuple<StageTs...> const& stages;
+            std::tuple<Inputs const&...> inputs;
+            WorkStealingPool& pool;
+            std::tuple<std::optional<DataflowValueOf<StageTs>>...> results{};
+            std::array<std::atomic<std::size_t>, stageCount> remaining{};
+            std::latch done{static_cast<std::ptrdiff_t>(stageCount)};
+            [[no_unique_address]] std::conditional_t<isNoexcept, NoException, std::atomic<bool>> failed{};
+            /// unavailable[stage] is set when the stage threw or was skipped, before its consumers are counted down.
+            [[no_unique_address]] std::conditional_t<isNoexcept, NoException, std::array<bool, stageCount>>
+                unavailable{};
+            [[no_unique_address]] std::conditional_t<isNoexcept, NoException, std::exception_ptr> exception{};
+
+            template <std::size_t product>
+            decltype(auto) productValue() const noexcept
+            {
+                if constexpr (product < stageCount)
+                    return static_cast<DataflowValueOf<PackElement<product, StageTs...>> const&>(
+                        *std::get<product>(results));
+                else
+                    return std::get<product - stageCount>(inputs);
+            }
+
+            template <std::size_t stage>
+            void invokeStage()
+            {
+                using Stage = typename GraphT::template Stage<stage>;
+                [&]<std::size_t... arguments>(std::index_sequence<arguments...>) {
+                    auto call = [&] {
+                        return std::invoke(
+                            std::get<stage>(stages), productValue<GraphT::template producer<stage, arguments>>()...);
+                    };
+                    if constexpr (std::is_void_v<typename Stage::ReturnType>)
+                    {
+                        call();
+                        std::get<stage>(results).emplace();
+                    }
+                    else
+                        std::get<stage>(results).emplace(call());
+                }(std::make_index_sequence<Stage::arity>{});
+            }
+
+            /// False when a producer of the stage threw or was skipped, read after the dependencies were counted down.
+            template <std::size_t stage>
+            bool producersAvailable() const noexcept
+            {
+                for (std::size_t producer = 0; producer != stageCount; ++producer)
+                    if (GraphT::dependencies[stage][producer] && unavailable[producer])
+                        return false;
+                return true;
+            }
+
+            template <std::size_t stage>
+            static void runStage(DataflowRun& run) noexcept
+            {
+                if constexpr (isNoexcept)
+                    run.invokeStage<stage>();
+                else if (run.producersAvailable<stage>())
+                {
+                    // The first exception is rethrown by run, independent stages still run.
+                    try
+                    {
+                        run.invokeStage<stage>();
+                    }
+                    catch (...)
+                    {
+                        run.unavailable[stage] = true;
+                        if (!run.failed.exchange(true, std::memory_order_acq_rel))
+                            run.exception = std::current_exception();
+                    }
+                }
+                else
+                    run.unavailable[stage] = true;
+
+                std::size_t next = stageCount;
+                for (std::size_t consumer = 0; consumer != stageCount; ++consumer)
+                {
+                    if (!GraphT::dependencies[consumer][stage] ||
+                        run.remaining[consumer].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                        continue;
+                    // The last ready consumer continues on this thread, the others go to the pool.
+                    if (next != stageCount)
+                        run.start(next);
+                    next = consumer;
+                }
+                // Counted down before continuing, afterwards the run may only be touched by unfinished stages.
+                run.done.count_down();
+                if (next != stageCount)
+                    runner(next)(run);
+            }
+
+            /// The function running the stage with the given runtime index.
+            static RunnerType runner(std::size_t stage) noexcept
+            {
+                constexpr static auto runners = []<std::size_t... stages>(std::index_sequence<stages...>) {
+                    return std::array<RunnerType, stageCount>{&runStage<stages>...};
+                }(std::make_index_sequence<stageCount>{});
+                return runners[stage];
+            }
+
+            void start(std::size_t stage) noexcept
+            {
+                pool.post([this, stage]() noexcept { runner(stage)(*this); });
+            }
+
+            void execute()
+            {
+                std::size_t first = stageCount;
+                for (std::size_t stage = 0; stage != stageCount; ++stage)
+                {
+                    remaining[stage].store(GraphT::dependencyCounts[stage], std::memory_order_relaxed);
+                    if (GraphT::dependencyCounts[stage] != 0)
+                        continue;
+                    if (first != stageCount)
+                        start(first);
+                    first = stage;
+                }
+                runner(first)(*this);
+
+                while (!done.try_wait())
+                    if (!pool.runPendingTask())
+                        done.wait();
+
+                if constexpr (!isNoexcept)
+                    if (exception)
+                        std::rethrow_exception(exception);
+            }
+        };
+    }
+
+    /**
+     * @brief A set of stages whose dependencies are derived at compile time: an argument of a stage is the result of
+     * the stage (or the external input) whose decayed type equals the decayed argument type (ArgumentDecayed<N>).
+     * run executes every stage once, stages whose dependencies are done run concurrently on a WorkStealingPool. The
+     * results are held in a tuple on the stack of the caller, nothing is allocated besides the posted tasks.
+     *
+     * @tparam StageTs The stages, functions with a unique signature that can be called as const.
+     */
+    template <typename... StageTs>
+    class Dataflow
+    {
+      public:
+        /// The results of run: the value of every stage in declaration order, NoResult for void stages.
+        using ResultsType = std::tuple<Detail::DataflowValueOf<StageTs>...>;
+
+        constexpr explicit Dataflow(StageTs... stages)
+            : stages_{std::move(stages)...}
+        {
+            static_assert(sizeof...(StageTs) > 0, "A Dataflow needs at least one stage.");
+            static_assert(
+                (Detail::HasFunctionTraits<StageTs> && ...),
+                "Dataflow stages must have a unique signature, e.g. not be generic lambdas.");
+            static_assert(
+                ((!Detail::IsFunctionObject<StageTs> || FunctionTraitsCore<StageTs>::qualifiers.isConst) && ...),
+                "Dataflow stages must be callable as const, they may run on any thread.");
+        }
+
+        /**
+         * @brief Runs all stages on the pool, the calling thread participates. Fails to compile if an argument has no
+         * or more than one producer, or if the dependencies contain a cycle.
+         *
+         * @param pool The pool the independent stages run on.
+         * @param inputs The external inputs, each one provides the arguments of its decayed type.
+         * @return ResultsType The results of all stages.
+         * @throws The first exception thrown by a stage. The stages depending on a failed stage, directly or through
+         * a skipped one, are skipped, the others still run.
+         */
+        template <typename... Inputs>
+        ResultsType run(WorkStealingPool& pool, Inputs const&... inputs) const
+        {
+            using Graph = Detail::DataflowGraph<TypeList<Inputs...>, StageTs...>;
+            static_assert(Graph::isAcyclic, "The dependencies of the Dataflow stages contain a cycle.");
+
+            Detail::DataflowRun<Graph, std::tuple<StageTs...>, std::tuple<Inputs...>> state{
+                .stages = stages_, .inputs = {inputs...}, .pool = pool};
+            state.execute();
+            return std::apply(
+                [](auto&... results) { return ResultsType{std::move(*results)...}; }, state.results);
+        }
+
+        /**
+         * @brief Runs all stages on the default pool.
+         */
+        template <typename... Inputs>
+        ResultsType operator()(Inputs const&... inputs) const
+        {
+            return run(WorkStealingPool::defaultPool(), inputs...);
+        }
+
+      private:
+        std::tuple<StageTs...> stages_;
+    };
+
+    /**
+     * @brief Creates a Dataflow from the stages.
+     */
+    template <typename... StageTs>
+    constexpr Dataflow<std::decay_t<StageTs>...> dataflow(StageTs&&... stages)
+    {
+        return Dataflow<std::decay_t<StageTs>...>{std::forward<StageTs>(stages)...};
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    /**
+     * @brief True for function objects without any state: empty, default constructible and trivially copyable, like
+     * captureless lambdas. Such callables can be represented by a plain function pointer (see toFunctionPointer).
+     *
+     * @tparam FunctionT The function object type.
+     */
+    template <typename FunctionT>
+    concept IsStateless = std::is_class_v<std::remove_cvref_t<FunctionT>> &&
+        std::is_empty_v<std::remove_cvref_t<FunctionT>> &&
+        std::is_default_constructible_v<std::remove_cvref_t<FunctionT>> &&
+        std::is_trivially_copyable_v<std::remove_cvref_t<FunctionT>>;
+
+    /**
+     * @brief The plain function pointer type matching the signature of a function, keeping the noexcept qualifier,
+     * e.g. "int (*)(double) noexcept" for "[](double) noexcept { return 0; }".
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using FunctionPointerOf = std::add_pointer_t<typename Detail::QualifiedSignature<
+        typename FunctionTraitsCore<FunctionT>::Signature,
+        false,
+        FunctionTraitsCore<FunctionT>::qualifiers.isNoexcept>::type>;
+
+    namespace Detail
+    {
+        template <typename FunctionT, typename SignatureT>
+        struct StatelessInvoker;
+
+        /**
+         * @brief Invokes a default constructed instance of a stateless function object, this is the function pointer
+         * toFunctionPointer returns when the function object does not convert to a function pointer itself.
+         */
+        template <typename FunctionT, typename ReturnT, typename... Args, bool isNoexcept>
+        struct StatelessInvoker<FunctionT, ReturnT(Args...) noexcept(isNoexcept)>
+        {
+            static ReturnT invoke(Args... args) noexcept(isNoexcept)
+            {
+                FunctionT function{};
+                if constexpr (FunctionTraitsCore<FunctionT>::qualifiers.isRvalueReferenceQualified)
+                    return std::move(function)(std::forward<Args>(args)...);
+                else
+                    return function(std::forward<Args>(args)...);
+            }
+        };
+
+        template <typename FunctionT>
+        concept IsConvertibleToFunctionPointer = HasFunctionTraits<std::decay_t<FunctionT>> &&
+            !std::is_member_function_pointer_v<std::decay_t<FunctionT>> &&
+            (IsStateless<FunctionT> || std::is_function_v<std::remove_pointer_t<std::decay_t<FunctionT>>>);
+    }
+
+    /**
+     * @brief Converts a function, function pointer or stateless function object into a plain function pointer with the
+     * same signature and noexcept qualifier. Captureless lambdas use their own conversion, other stateless function
+     * objects are invoked through a default constructed instance.
+     *
+     * @param function The function to convert.
+     * @return FunctionPointerOf<F> The function pointer.
+     */
+    template <typename FunctionT>
+    requires Detail::IsConvertibleToFunctionPointer<FunctionT>
+    constexpr FunctionPointerOf<std::decay_t<FunctionT>> toFunctionPointer(FunctionT&& function) noexcept
+    {
+        using FunctionType = std::decay_t<FunctionT>;
+        using PointerType = FunctionPointerOf<FunctionType>;
+
+        if constexpr (std::is_convertible_v<FunctionT, PointerType>)
+            return static_cast<PointerType>(std::forward<FunctionT>(function));
+        else
+            return &Detail::StatelessInvoker<FunctionType, std::remove_pointer_t<PointerType>>::invoke;
+    }
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    template <typename SignatureT>
+    class FunctionRef;
+
+    namespace Detail
+    {
+        /// The result of a call can be returned as ReturnT, anything can be returned as void.
+        template <typename ResultT, typename ReturnT>
+        concept ReturnsAs = std::is_void_v<ReturnT> || std::is_convertible_v<ResultT, ReturnT>;
+
+        /**
+         * @brief The implementation of FunctionRef for all supported signatures.
+         *
+         * @tparam isConst Whether the referenced callable is invoked as const.
+         * @tparam isNoexcept Whether the referenced callable must be noexcept.
+         * @tparam ReturnT The return type of the signature.
+         * @tparam Args The argument types of the signature.
+         */
+        template <bool isConst, bool isNoexcept, typename ReturnT, typename... Args>
+        class FunctionRefImpl
+        {
+          private:
+            union Storage
+            {
+                void const* object;
+                void (*function)();
+            };
+
+            using InvokerType = ReturnT (*)(Storage, Args...) noexcept(isNoexcept);
+
+            template <typename CallableT>
+            using QualifiedCallable = std::conditional_t<isConst, CallableT const&, CallableT&>;
+
+            /// Checked with the plain call syntax the invokers use, member function pointers are not callable that way.
+            template <typename CallableT>
+            constexpr static bool isCompatible =
+                requires(QualifiedCallable<CallableT> callable, Args&&... args) {
+                    { callable(std::forward<Args>(args)...) } -> ReturnsAs<ReturnT>;
+                    requires !isNoexcept || noexcept(callable(std::forward<Args>(args)...));
+                };
+
+            template <typename CallableT>
+            constexpr static bool isFunction =
+                std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<CallableT>>>;
+
+          public:
+            /**
+             * @brief References the given callable, which must outlive the FunctionRef. Function pointers and
+             * functions are stored directly, so they may be temporaries.
+             *
+             * @param callable A function, function pointer or function object.
+             */
+            template <typename CallableT>
+            requires(!std::is_same_v<std::remove_cvref_t<CallableT>, FunctionRefImpl> &&
+                     !std::is_base_of_v<FunctionRefImpl, std::remove_cvref_t<CallableT>> &&
+                     isCompatible<std::remove_reference_t<CallableT>>)
+            FunctionRefImpl(CallableT&& callable) noexcept
+                : storage_{}
+                , invoker_{}
+            {
+                using CallableType = std::remove_reference_t<CallableT>;
+                if constexpr (isFunction<CallableT>)
+                {
+                    using FunctionPointerType =
+                        std::add_pointer_t<std::remove_pointer_t<std::remove_cvref_t<CallableT>>>;
+                    storage_.function = reinterpret_cast<void (*)()>(static_cast<FunctionPointerType>(callable));
+                    invoker_ = &invokeFunction<FunctionPointerType>;
+                }
+                else
+                {
+                    // __builtin_addressof instead of std::addressof to not depend on <memory>.
+                    storage_.object = static_cast<void const*>(__builtin_addressof(callable));
+                    invoker_ = &invokeObject<CallableType>;
+                }
+            }
+
+            FunctionRefImpl(FunctionRefImpl const&) = default;
+            FunctionRefImpl& operator=(FunctionRefImpl const&) = default;
+
+            /**
+             * @brief Invokes the referenced callable.
+             */
+            ReturnT operator()(Args... args) const noexcept(isNoexcept)
+            {
+                return invoker_(storage_, std::forward<Args>(args)...);
+            }
+
+          private:
+            template <typename FunctionPointerT>
+            static ReturnT invokeFunction(Storage storage, Args... args) noexcept(isNoexcept)
+            {
+                auto* function = reinterpret_cast<FunctionPointerT>(storage.function);
+                if constexpr (std::is_void_v<ReturnT>)
+                    function(std::forward<Args>(args)...);
+                else
+                    return function(std::forward<Args>(args)...);
+            }
+
+            template <typename CallableT>
+            static ReturnT invokeObject(Storage storage, Args... args) noexcept(isNoexcept)
+            {
+                QualifiedCallable<CallableT> callable =
+                    *const_cast<CallableT*>(static_cast<std::add_const_t<CallableT>*>(storage.object));
+                if constexpr (std::is_void_v<ReturnT>)
+                    callable(std::forward<Args>(args)...);
+                else
+                    return callable(std::forward<Args>(args)...);
+            }
+
+          private:
+            Storage storage_;
+            InvokerType invoker_;
+        };
+    }
+
+    /**
+     * @brief A non-owning reference to a callable, two pointers wide, trivially copyable and never allocating. The
+     * referenced callable must outlive the FunctionRef, which makes it a good fit for callback parameters.
+     *
+     * A "const" signature (e.g. FunctionRef<int(int) const>) only binds callables that can be invoked as const, a
+     * "noexcept" signature only binds noexcept callables and makes the call operator noexcept.
+     *
+     * @tparam ReturnT The return type of the signature.
+     * @tparam Args The argument types of the signature.
+     */
+    template <typename ReturnT, typename... Args, bool isNoexcept>
+    class FunctionRef<ReturnT(Args...) noexcept(isNoexcept)>
+        : public Detail::FunctionRefImpl<false, isNoexcept, ReturnT, Args...>
+    {
+      public:
+        using Detail::FunctionRefImpl<false, isNoexcept, ReturnT, Args...>::FunctionRefImpl;
+    };
+
+    template <typename ReturnT, typename... Args, bool isNoexcept>
+    class FunctionRef<ReturnT(Args...) const noexcept(isNoexcept)>
+        : public Detail::FunctionRefImpl<true, isNoexcept, ReturnT, Args...>
+    {
+      public:
+        using Detail::FunctionRefImpl<true, isNoexcept, ReturnT, Args...>::FunctionRefImpl;
+    };
+
+    template <typename FunctionT>
+    requires std::is_function_v<FunctionT>
+    FunctionRef(FunctionT*) -> FunctionRef<FunctionT>;
+
+    /**
+     * @brief The FunctionRef matching the call signature of a function, keeping its const and noexcept qualifiers.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using FunctionRefOf = FunctionRef<Detail::CallSignatureOf<FunctionT>>;
+}
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <traits/type_list.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Traits
+{
+    template <typename MemberFunctionT>
+    struct FunctionTraitsImpl;
+
+    struct FunctionQualifiers
+    {
+        bool isConst = false;
+        bool isVolatile = false;
+        bool isReferenceQualified = false;
+        bool isRvalueReferenceQualified = false;
+        bool isNoexcept = false;
+
+        constexpr bool operator==(const FunctionQualifiers& other) const noexcept
+        {
+            return isConst == other.isConst && isVolatile == other.isVolatile &&
+                isReferenceQualified == other.isReferenceQualified &&
+                isRvalueReferenceQualified == other.isRvalueReferenceQualified && isNoexcept == other.isNoexcept;
+        }
+    };
+
+    /**
+     * @brief This class provides information about a function type, such as its return type, argument types, and arity.
+     *
+     * @tparam ReturnT The return type of the function.
+     * @tparam Args The argument types of the function.
+     */
+    template <typename ReturnT, FunctionQualifiers qualifiersValue = FunctionQualifiers{}, typename... Args>
+    struct FunctionTraitsCommon
+    {
+      public:
+        /// The return type of the function.
+        using ReturnType = ReturnT;
+
+        /// The arguments of the function as a TypeList, a lightweight alternative to ArgsTuple.
+        using ArgsTypeList = TypeList<Args...>;
+
+        /// The arguments of the function as a TypeList with decayed types. Decayed means that references and
+        /// qualifiers (const / volatile) are removed.
+        using ArgsTypeListDecayed = TypeList<std::decay_t<Args>...>;
+
+        /// The unqualified function type, e.g. int(double) for a "int (Class::*)(double) const noexcept".
+        using Signature = ReturnT(Args...);
+
+        /// The unqualified function type with decayed argument types (removes references and qualifiers).
+        using SignatureDecayed = ReturnT(std::decay_t<Args>...);
+
+        /// The qualifiers of the function, such as const, volatile, reference, rvalue reference, and noexcept.
+        constexpr static FunctionQualifiers qualifiers = qualifiersValue;
+
+        /// The number of arguments of the function (= arity)
+        constexpr static auto arity = sizeof...(Args);
+
+        /// Allows for accessing the N-th argument type of the function.
+        template <std::size_t N>
+        using Argument = PackElement<N, Args...>;
+
+        /// Allows for accessing the N-th argument type of the function with decayed types (removes references and
+        /// qualifiers).
+        template <std::size_t N>
+        using ArgumentDecayed = std::decay_t<PackElement<N, Args...>>;
+    };
+
+    /**
+     * @brief When the function is a member function, also provide the class type.
+     *
+     * @tparam ClassT The class type of the member function.
+     * @tparam ReturnT The return type of the member function.
+     * @tparam Args The argument types of the member function.
+     */
+    template <typename ClassT, typename ReturnT, FunctionQualifiers qualifiers, typename... Args>
+    struct FunctionTraitsClassCommon : public FunctionTraitsCommon<ReturnT, qualifiers, Args...>
+    {
+        /// The class type of the class owning the member function.
+        using ClassType = ClassT;
+    };
+
+    /**
+     * @brief Specialization for function pointers:
+     *
+     * @tparam ReturnT
+     * @tparam Args
+     */
+    template <typename ReturnT, typename... Args>
+    struct FunctionTraitsImpl<ReturnT (*)(Args...)>
+        : public FunctionTraitsCommon<ReturnT, FunctionQualifiers{}, Args...>
+    {};
+    template <typename ReturnT, typename... Args>
+    struct FunctionTraitsImpl<ReturnT (*)(Args...) noexcept>
+        : public FunctionTraitsCommon<ReturnT, FunctionQualifiers{.isNoexcept = true}, Args...>
+    {};
+
+#define TRAITS_LIB_CREATE_SPECIALIZATION(QUALIFIER, QUALIFIER_OBJECT) \
+    template <typename ReturnT, typename... Args> \
+    struct FunctionTraitsImpl<ReturnT(Args...) QUALIFIER> \
+        : public FunctionTraitsCommon<ReturnT, QUALIFIER_OBJECT, Args...> \
+    {}; \
+    template <typename ClassT, typename ReturnT, typename... ArgsT> \
+    struct FunctionTraitsImpl<ReturnT (ClassT::*)(ArgsT...) QUALIFIER> \
+        : public FunctionTraitsClassCommon<ClassT, ReturnT, QUALIFIER_OBJECT, ArgsT...> \
+    {};
+
+    // Specializations for all kinds of qualifiers
+    namespace Detail
+    {
+        constexpr FunctionQualifiers cvQualified{.isConst = true, .isVolatile = true};
+        constexpr FunctionQualifiers constRef{.isConst = true, .isReferenceQualified = true};
+        constexpr FunctionQualifiers volatileRef{.isVolatile = true, .isReferenceQualified = true};
+        constexpr FunctionQualifiers cvRef{.isConst = true, .isVolatile = true, .isReferenceQualified = true};
+        constexpr FunctionQualifiers constRvalueRef{.isConst = true, .isRvalueReferenceQualified = true};
+        constexpr FunctionQualifiers volatileRvalueRef{.isVolatile = true, .isRvalueReferenceQualified = true};
+        constexpr FunctionQualifiers cvRvalueRef{
+            .isConst = true,
+            .isVolatile = true,
+            .isRvalueReferenceQualified = true};
+
+        constexpr FunctionQualifiers constNoexcept{.isConst = true, .isNoexcept = true};
+        constexpr FunctionQualifiers volatileNoexcept{.isVolatile = true, .isNoexcept = true};
+        constexpr FunctionQualifiers cvNoexcept{.isConst = true, .isVolatile = true, .isNoexcept = true};
+        constexpr FunctionQualifiers refNoexcept{.isReferenceQualified = true, .isNoexcept = true};
+        constexpr FunctionQualifiers rvalueRefNoexcept{.isRvalueReferenceQualified = true, .isNoexcept = true};
+        constexpr FunctionQualifiers constRefNoexcept{
+            .isConst = true,
+            .isReferenceQualified = true,
+            .isNoexcept = true};
+        constexpr FunctionQualifiers volatileRefNoexcept{
+            .isVolatile = true,
+            .isReferenceQualified = true,
+            .isNoexcept = true};
+        constexpr FunctionQualifiers cvRefNoexcept{
+            .isConst = true,
+            .isVolatile = true,
+            .isReferenceQualified = true,
+            .isNoexcept = true};
+        constexpr FunctionQualifiers constRvalueRefNoexcept{
+            .isConst = true,
+            .isRvalueReferenceQualified = true,
+            .isNoexcept = true};
+        constexpr FunctionQualifiers volatileRvalueRefNoexcept{
+            .isVolatile = true,
+            .isRvalueReferenceQualified = true,
+            .isNoexcept = true};
+        constexpr FunctionQualifiers cvRvalueRefNoexcept{
+            .isConst = true,
+            .isVolatile = true,
+            .isRvalueReferenceQualified = true,
+            .isNoexcept = true};
+    }
+
+    TRAITS_LIB_CREATE_SPECIALIZATION(, FunctionQualifiers{})
+    TRAITS_LIB_CREATE_SPECIALIZATION(const, FunctionQualifiers{.isConst = true})
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile, FunctionQualifiers{.isVolatile = true})
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile, Detail::cvQualified)
+
+    TRAITS_LIB_CREATE_SPECIALIZATION(&, FunctionQualifiers{.isReferenceQualified = true})
+    TRAITS_LIB_CREATE_SPECIALIZATION(const&, Detail::constRef)
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile&, Detail::volatileRef)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile&, Detail::cvRef)
+    TRAITS_LIB_CREATE_SPECIALIZATION(&&, FunctionQualifiers{.isRvalueReferenceQualified = true})
+    TRAITS_LIB_CREATE_SPECIALIZATION(const&&, Detail::constRvalueRef)
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile&&, Detail::volatileRvalueRef)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile&&, Detail::cvRvalueRef)
+
+    TRAITS_LIB_CREATE_SPECIALIZATION(noexcept, FunctionQualifiers{.isNoexcept = true})
+    TRAITS_LIB_CREATE_SPECIALIZATION(const noexcept, Detail::constNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile noexcept, Detail::volatileNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile noexcept, Detail::cvNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(& noexcept, Detail::refNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(&& noexcept, Detail::rvalueRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const& noexcept, Detail::constRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile& noexcept, Detail::volatileRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile& noexcept, Detail::cvRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const&& noexcept, Detail::constRvalueRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(volatile&& noexcept, Detail::volatileRvalueRefNoexcept)
+    TRAITS_LIB_CREATE_SPECIALIZATION(const volatile&& noexcept, Detail::cvRvalueRefNoexcept)
+
+    namespace Detail
+    {
+        /**
+         * @brief This concept is true when the function is not a member function and not a regular function.
+         *
+         * @tparam FunctionT The function type to check.
+         */
+        template <typename FunctionT>
+        concept IsFunctionObject =
+            (!std::is_function_v<typename std::remove_pointer_t<FunctionT>> &&
+             !std::is_member_function_pointer_v<FunctionT>);
+
+        /**
+         * @brief This concept is true when the function is a regular function.
+         *
+         * @tparam FunctionT
+         */
+        template <typename FunctionT>
+        concept IsRegularFunction = std::is_function_v<FunctionT> && !std::is_member_function_pointer_v<FunctionT>;
+
+        /**
+         * @brief This concept is true when the function is a member function pointer.
+         *
+         * @tparam FunctionT
+         */
+        template <typename FunctionT>
+        concept IsMemberFunctionPointer = std::is_member_function_pointer_v<FunctionT>;
+
+        /**
+         * @brief This concept is true when the function object has exactly one, non template call operator. Generic
+         * lambdas do not, use FunctionTraitsFor for them.
+         *
+         * @tparam FunctionT
+         */
+        template <typename FunctionT>
+        concept HasUniqueCallOperator = requires { &std::decay_t<FunctionT>::operator(); };
+    } // namespace Detail
+
+    /**
+     * @brief The traits of a function type that do not depend on any heavy standard library header: return type,
+     * argument types, arity and qualifiers. FunctionTraits (traits/functions.hpp) extends these with the std::tuple and
+     * std::function aliases.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    struct FunctionTraitsCore
+    {};
+
+    /**
+     * @brief When the function is a function object (an object with function call operator), inspect the call operator
+     * instead and not the function object itself. This is also the specialization that makes lambda functions work.
+     *
+     * @tparam FunctionT
+     */
+    template <typename FunctionT>
+    requires Detail::IsFunctionObject<FunctionT> && Detail::HasUniqueCallOperator<FunctionT>
+    struct FunctionTraitsCore<FunctionT> : public FunctionTraitsImpl<decltype(&std::decay_t<FunctionT>::operator())>
+    {};
+
+    /**
+     * @brief This specialization is for regular functions.
+     *
+     * @tparam FunctionT
+     */
+    template <typename FunctionT>
+    requires Detail::IsRegularFunction<FunctionT>
+    struct FunctionTraitsCore<FunctionT> : public FunctionTraitsImpl<FunctionT>
+    {};
+
+    /**
+     * @brief This specialization is for function pointer types.
+     *
+     * @tparam FunctionT
+     */
+    template <typename FunctionT>
+    requires std::is_pointer_v<FunctionT> && std::is_function_v<std::remove_pointer_t<FunctionT>>
+    struct FunctionTraitsCore<FunctionT> : public FunctionTraitsImpl<FunctionT>
+    {};
+
+    /**
+     * @brief This specialization is for member function pointers.
+     *
+     * @tparam FunctionT
+     */
+    template <typename FunctionT>
+    requires Detail::IsMemberFunctionPointer<FunctionT>
+    struct FunctionTraitsCore<FunctionT> : public FunctionTraitsImpl<FunctionT>
+    {};
+
+    /**
+     * @brief The traits of a callable when it is invoked with the given argument types. This also works for callables
+     * FunctionTraitsCore can not inspect, like generic lambdas and function objects with overloaded or templated call
+     * operators. Argument<N> are the given types, ReturnType is the invoke result, qualifiers.isConst is set when the
+     * callable can be invoked as const and qualifiers.isNoexcept when the invocation is noexcept.
+     *
+     * @tparam FunctionT The callable type.
+     * @tparam Args The argument types to invoke the callable with.
+     */
+    template <typename FunctionT, typename... Args>
+    requires std::is_invocable_v<std::remove_reference_t<FunctionT>&, Args...>
+    struct FunctionTraitsFor
+        : public FunctionTraitsCommon<
+              std::invoke_result_t<std::remove_reference_t<FunctionT>&, Args...>,
+              FunctionQualifiers{
+                  .isConst = std::is_invocable_v<std::remove_reference_t<FunctionT> const&, Args...>,
+                  .isNoexcept = std::is_nothrow_invocable_v<std::remove_reference_t<FunctionT>&, Args...>},
+              Args...>
+    {};
+
+    namespace Detail
+    {
+        /**
+         * @brief This concept is true when FunctionTraitsCore can inspect the function type.
+         *
+         * @tparam FunctionT
+         */
+        template <typename FunctionT>
+        concept HasFunctionTraits = requires { typename FunctionTraitsCore<FunctionT>::ReturnType; };
+
+        template <typename SignatureT, bool isConst, bool isNoexcept>
+        struct QualifiedSignature;
+
+        template <typename ReturnT, typename... Args, bool isNoexcept>
+        struct QualifiedSignature<ReturnT(Args...), false, isNoexcept>
+        {
+            using type = ReturnT(Args...) noexcept(isNoexcept);
+        };
+
+        template <typename ReturnT, typename... Args, bool isNoexcept>
+        struct QualifiedSignature<ReturnT(Args...), true, isNoexcept>
+        {
+            using type = ReturnT(Args...) const noexcept(isNoexcept);
+        };
+
+        /**
+         * @brief The signature of a function with only the const and noexcept qualifiers kept, e.g.
+         * "int(double) const noexcept". This is the signature type erased callables (FunctionRef, InplaceFunction) are
+         * parameterized with.
+         *
+         * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+         */
+        template <typename FunctionT>
+        using CallSignatureOf = typename QualifiedSignature<
+            typename FunctionTraitsCore<FunctionT>::Signature,
+            FunctionTraitsCore<FunctionT>::qualifiers.isConst,
+            FunctionTraitsCore<FunctionT>::qualifiers.isNoexcept>::type;
+    } // namespace Detail
+}
\ No newline at end of file
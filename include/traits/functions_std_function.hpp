@@ -0,0 +1,24 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <functional>
+
+namespace Traits
+{
+    /**
+     * @brief The function type as a std::function.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using StandardFunctionOf = std::function<typename FunctionTraitsCore<FunctionT>::Signature>;
+
+    /**
+     * @brief The function type as a std::function with decayed argument types (removes references and qualifiers).
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using StandardFunctionDecayedOf = std::function<typename FunctionTraitsCore<FunctionT>::SignatureDecayed>;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <tuple>
+#include <type_traits>
+
+namespace Traits
+{
+    /**
+     * @brief The arguments of a function as a std::tuple.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using ArgsTupleOf = typename FunctionTraitsCore<FunctionT>::ArgsTypeList::template Apply<std::tuple>;
+
+    /**
+     * @brief The arguments of a function as a std::tuple with decayed types (removes references and qualifiers).
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    using ArgsTupleDecayedOf = typename FunctionTraitsCore<FunctionT>::ArgsTypeListDecayed::template Apply<std::tuple>;
+}
\ No newline at end of file
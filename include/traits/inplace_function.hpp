@@ -0,0 +1,251 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    /// The default capacity of InplaceFunction in bytes.
+    constexpr std::size_t defaultInplaceFunctionCapacity = 4 * sizeof(void*);
+
+    template <
+        typename SignatureT,
+        std::size_t capacity = defaultInplaceFunctionCapacity,
+        std::size_t alignment = alignof(std::max_align_t)>
+    class InplaceFunction;
+
+    namespace Detail
+    {
+        template <typename T>
+        struct IsInplaceFunction : std::false_type
+        {};
+
+        template <typename SignatureT, std::size_t capacity, std::size_t alignment>
+        struct IsInplaceFunction<InplaceFunction<SignatureT, capacity, alignment>> : std::true_type
+        {};
+
+        /**
+         * @brief The implementation of InplaceFunction for all supported signatures.
+         *
+         * @tparam isConst Whether the stored callable is invoked as const.
+         * @tparam isNoexcept Whether the stored callable must be noexcept.
+         * @tparam capacity The size of the inline storage in bytes.
+         * @tparam alignment The alignment of the inline storage.
+         * @tparam ReturnT The return type of the signature.
+         * @tparam Args The argument types of the signature.
+         */
+        template <
+            bool isConst,
+            bool isNoexcept,
+            std::size_t capacity,
+            std::size_t alignment,
+            typename ReturnT,
+            typename... Args>
+        class InplaceFunctionImpl
+        {
+          private:
+            using InvokerType = ReturnT (*)(void*, Args...) noexcept(isNoexcept);
+
+            /// Move constructs the callable from source into destination and destroys the source. When destination is
+            /// nullptr the source is only destroyed.
+            using ManagerType = void (*)(void* destination, void* source) noexcept;
+
+            template <typename CallableT>
+            using QualifiedCallable = std::conditional_t<isConst, CallableT const&, CallableT&>;
+
+            template <typename CallableT>
+            constexpr static bool isCompatible = isNoexcept
+                ? std::is_nothrow_invocable_r_v<ReturnT, QualifiedCallable<CallableT>, Args...>
+                : std::is_invocable_r_v<ReturnT, QualifiedCallable<CallableT>, Args...>;
+
+          public:
+            InplaceFunctionImpl() noexcept = default;
+
+            /**
+             * @brief Stores the callable inline. Fails to compile if it does not fit into the capacity / alignment. A
+             * null function pointer or member pointer leaves the InplaceFunction empty, like std::function.
+             *
+             * @param callable A function pointer, member pointer or function object, which is moved (or copied) into
+             * the storage.
+             */
+            template <typename CallableT>
+            requires(!std::is_base_of_v<InplaceFunctionImpl, std::remove_cvref_t<CallableT>> &&
+                     !IsInplaceFunction<std::remove_cvref_t<CallableT>>::value &&
+                     isCompatible<std::decay_t<CallableT>>)
+            InplaceFunctionImpl(CallableT&& callable) noexcept(
+                std::is_nothrow_constructible_v<std::decay_t<CallableT>, CallableT>)
+            {
+                using CallableType = std::decay_t<CallableT>;
+                static_assert(
+                    sizeof(CallableType) <= capacity,
+                    "The callable does not fit into the InplaceFunction, increase its capacity.");
+                static_assert(
+                    alignof(CallableType) <= alignment,
+                    "The callable is over-aligned for the InplaceFunction, increase its alignment.");
+                static_assert(
+                    std::is_nothrow_move_constructible_v<CallableType>,
+                    "InplaceFunction requires callables that are nothrow move constructible.");
+
+                if constexpr (std::is_pointer_v<CallableType> || std::is_member_pointer_v<CallableType>)
+                {
+                    if (callable == nullptr)
+                        return;
+                }
+
+                ::new (static_cast<void*>(storage_)) CallableType(std::forward<CallableT>(callable));
+                invoker_ = &invoke<CallableType>;
+                manager_ = &manage<CallableType>;
+            }
+
+            InplaceFunctionImpl(InplaceFunctionImpl const&) = delete;
+            InplaceFunctionImpl& operator=(InplaceFunctionImpl const&) = delete;
+
+            InplaceFunctionImpl(InplaceFunctionImpl&& other) noexcept
+            {
+                takeFrom(other);
+            }
+
+            InplaceFunctionImpl& operator=(InplaceFunctionImpl&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    reset();
+                    takeFrom(other);
+                }
+                return *this;
+            }
+
+            ~InplaceFunctionImpl()
+            {
+                reset();
+            }
+
+            /**
+             * @brief Destroys the stored callable, afterwards the InplaceFunction is empty.
+             */
+            void reset() noexcept
+            {
+                if (manager_ != nullptr)
+                {
+                    manager_(nullptr, storage_);
+                    invoker_ = nullptr;
+                    manager_ = nullptr;
+                }
+            }
+
+            /**
+             * @brief Returns true if a callable is stored.
+             */
+            explicit operator bool() const noexcept
+            {
+                return invoker_ != nullptr;
+            }
+
+            /**
+             * @brief Invokes the stored callable, the InplaceFunction must not be empty.
+             */
+            ReturnT operator()(Args... args) noexcept(isNoexcept)
+            requires(!isConst)
+            {
+                return invoker_(storage_, std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Invokes the stored callable as const, the InplaceFunction must not be empty.
+             */
+            ReturnT operator()(Args... args) const noexcept(isNoexcept)
+            requires isConst
+            {
+                return invoker_(const_cast<std::byte*>(storage_), std::forward<Args>(args)...);
+            }
+
+          private:
+            void takeFrom(InplaceFunctionImpl& other) noexcept
+            {
+                if (other.manager_ != nullptr)
+                {
+                    other.manager_(storage_, other.storage_);
+                    invoker_ = other.invoker_;
+                    manager_ = other.manager_;
+                    other.invoker_ = nullptr;
+                    other.manager_ = nullptr;
+                }
+            }
+
+            template <typename CallableT>
+            static ReturnT invoke(void* storage, Args... args) noexcept(isNoexcept)
+            {
+                QualifiedCallable<CallableT> callable = *std::launder(static_cast<CallableT*>(storage));
+                if constexpr (std::is_void_v<ReturnT>)
+                    std::invoke(callable, std::forward<Args>(args)...);
+                else
+                    return std::invoke(callable, std::forward<Args>(args)...);
+            }
+
+            template <typename CallableT>
+            static void manage(void* destination, void* source) noexcept
+            {
+                auto* callable = std::launder(static_cast<CallableT*>(source));
+                if (destination != nullptr)
+                    ::new (destination) CallableT(std::move(*callable));
+                callable->~CallableT();
+            }
+
+          private:
+            alignas(alignment) std::byte storage_[capacity];
+            InvokerType invoker_ = nullptr;
+            ManagerType manager_ = nullptr;
+        };
+    }
+
+    /**
+     * @brief A move-only owning callable that stores its target inline and never allocates. Callables that do not fit
+     * into the capacity / alignment are rejected at compile time. A "const" signature requires a callable that can be
+     * invoked as const and makes the call operator const, "noexcept" requires a noexcept callable and makes the call
+     * operator noexcept.
+     *
+     * @tparam ReturnT The return type of the signature.
+     * @tparam Args The argument types of the signature.
+     * @tparam capacity The size of the inline storage in bytes.
+     * @tparam alignment The alignment of the inline storage.
+     */
+    template <typename ReturnT, typename... Args, bool isNoexcept, std::size_t capacity, std::size_t alignment>
+    class InplaceFunction<ReturnT(Args...) noexcept(isNoexcept), capacity, alignment>
+        : public Detail::InplaceFunctionImpl<false, isNoexcept, capacity, alignment, ReturnT, Args...>
+    {
+      private:
+        using Impl = Detail::InplaceFunctionImpl<false, isNoexcept, capacity, alignment, ReturnT, Args...>;
+
+      public:
+        using Impl::Impl;
+    };
+
+    template <typename ReturnT, typename... Args, bool isNoexcept, std::size_t capacity, std::size_t alignment>
+    class InplaceFunction<ReturnT(Args...) const noexcept(isNoexcept), capacity, alignment>
+        : public Detail::InplaceFunctionImpl<true, isNoexcept, capacity, alignment, ReturnT, Args...>
+    {
+      private:
+        using Impl = Detail::InplaceFunctionImpl<true, isNoexcept, capacity, alignment, ReturnT, Args...>;
+
+      public:
+        using Impl::Impl;
+    };
+
+    /**
+     * @brief The InplaceFunction matching the call signature of a function, keeping its const and noexcept qualifiers.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     * @tparam capacity The size of the inline storage in bytes.
+     * @tparam alignment The alignment of the inline storage.
+     */
+    template <
+        typename FunctionT,
+        std::size_t capacity = defaultInplaceFunctionCapacity,
+        std::size_t alignment = alignof(std::max_align_t)>
+    using InplaceFunctionOf = InplaceFunction<Detail::CallSignatureOf<FunctionT>, capacity, alignment>;
+}
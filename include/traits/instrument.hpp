@@ -0,0 +1,421 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/signature_id.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Set to 0 to compile instrumented functions to plain calls, nothing is recorded then. Translation units with
+/// different settings may be linked together: Instrumented and instrument live in an inline namespace named after the
+/// setting, so each setting has its own types and symbols instead of two conflicting definitions.
+#ifndef TRAITS_LIB_ENABLE_INSTRUMENTATION
+#define TRAITS_LIB_ENABLE_INSTRUMENTATION 1
+#endif
+
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+#    define TRAITS_LIB_INSTRUMENTATION_NAMESPACE InstrumentationEnabled
+#else
+#    define TRAITS_LIB_INSTRUMENTATION_NAMESPACE InstrumentationDisabled
+#endif
+
+namespace Traits
+{
+    /**
+     * @brief A histogram of latencies in nanoseconds with log-linear buckets like HdrHistogram: every power of two is
+     * split into subBucketCount buckets, so values are recorded with a relative error below 1 / subBucketCount.
+     */
+    struct LatencyHistogram
+    {
+        constexpr static std::size_t subBucketBits = 3;
+        constexpr static std::size_t subBucketCount = std::size_t{1} << subBucketBits;
+        constexpr static std::size_t bucketCount = (65 - subBucketBits) * subBucketCount;
+
+        /**
+         * @brief The bucket of a value, values below subBucketCount have their own bucket.
+         */
+        constexpr static std::size_t bucketIndex(std::uint64_t value) noexcept
+        {
+            if (value < subBucketCount)
+                return static_cast<std::size_t>(value);
+            auto const magnitude = static_cast<std::size_t>(std::bit_width(value)) - subBucketBits;
+            auto const subBucket = static_cast<std::size_t>(value >> (magnitude - 1)) & (subBucketCount - 1);
+            return magnitude * subBucketCount + subBucket;
+        }
+
+        /**
+         * @brief The smallest value of a bucket.
+         */
+        constexpr static std::uint64_t bucketLowerBound(std::size_t index) noexcept
+        {
+            if (index < subBucketCount)
+                return index;
+            auto const magnitude = index / subBucketCount;
+            return (subBucketCount + index % subBucketCount) << (magnitude - 1);
+        }
+
+        /**
+         * @brief The number of recorded values.
+         */
+        std::uint64_t count() const noexcept
+        {
+            std::uint64_t count = 0;
+            for (auto const bucket : buckets)
+                count += bucket;
+            return count;
+        }
+
+        /**
+         * @brief The largest value of the bucket that contains the given quantile, 0 if the histogram is empty.
+         *
+         * @param quantile Between 0 and 1, e.g. 0.99 for the 99th percentile.
+         */
+        std::uint64_t percentile(double quantile) const noexcept
+        {
+            auto const total = count();
+            if (total == 0)
+                return 0;
+            auto const rank =
+                std::max<std::uint64_t>(static_cast<std::uint64_t>(quantile * static_cast<double>(total)), 1);
+            std::uint64_t seen = 0;
+            for (std::size_t index = 0; index != bucketCount; ++index)
+            {
+                seen += buckets[index];
+                if (seen >= rank)
+                {
+                    if (index + 1 == bucketCount)
+                        return std::numeric_limits<std::uint64_t>::max();
+                    return bucketLowerBound(index + 1) - 1;
+                }
+            }
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        std::array<std::uint64_t, bucketCount> buckets{};
+    };
+
+    /**
+     * @brief The statistics of one instrumented function at one point in time.
+     */
+    struct CallStatsSnapshot
+    {
+        std::string name;
+        std::uint64_t signatureId = 0;
+        /// The sizes of the decayed argument types (ArgumentDecayed<N>) in bytes.
+        std::vector<std::size_t> argumentBytes;
+        std::uint64_t calls = 0;
+        std::uint64_t totalNanoseconds = 0;
+        LatencyHistogram latency;
+    };
+
+    /**
+     * @brief The statistics recorded for one name and signature. Recording is lock-free: threads are assigned round
+     * robin to shardCount cache line aligned shards, which they update with relaxed atomic increments. With more than
+     * shardCount threads several threads share a shard. snapshot merges the shards.
+     */
+    class CallStats
+    {
+      public:
+        constexpr static std::size_t shardCount = 8;
+
+        CallStats(std::string name, std::uint64_t signatureId, std::vector<std::size_t> argumentBytes)
+            : name_{std::move(name)}
+            , signatureId_{signatureId}
+            , argumentBytes_{std::move(argumentBytes)}
+        {}
+
+        CallStats(CallStats const&) = delete;
+        CallStats& operator=(CallStats const&) = delete;
+
+        /**
+         * @brief Records one call that took the given time.
+         */
+        void record(std::uint64_t nanoseconds) noexcept
+        {
+            auto& shard = shards_[threadShard()];
+            shard.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+            shard.buckets[LatencyHistogram::bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::string_view name() const noexcept
+        {
+            return name_;
+        }
+
+        std::uint64_t signatureId() const noexcept
+        {
+            return signatureId_;
+        }
+
+        /**
+         * @brief Merges the shards, calls that are recorded concurrently may or may not be included.
+         */
+        CallStatsSnapshot snapshot() const
+        {
+            CallStatsSnapshot snapshot;
+            snapshot.name = name_;
+            snapshot.signatureId = signatureId_;
+            snapshot.argumentBytes = argumentBytes_;
+            for (auto const& shard : shards_)
+            {
+                snapshot.totalNanoseconds += shard.totalNanoseconds.load(std::memory_order_relaxed);
+                for (std::size_t index = 0; index != LatencyHistogram::bucketCount; ++index)
+                    snapshot.latency.buckets[index] += shard.buckets[index].load(std::memory_order_relaxed);
+            }
+            snapshot.calls = snapshot.latency.count();
+            return snapshot;
+        }
+
+        /**
+         * @brief Sets all counters to zero.
+         */
+        void reset() noexcept
+        {
+            for (auto& shard : shards_)
+            {
+                shard.totalNanoseconds.store(0, std::memory_order_relaxed);
+                for (auto& bucket : shard.buckets)
+                    bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+      private:
+        struct alignas(64) Shard
+        {
+            std::atomic<std::uint64_t> totalNanoseconds{0};
+            std::array<std::atomic<std::uint64_t>, LatencyHistogram::bucketCount> buckets{};
+        };
+
+        static std::size_t threadShard() noexcept
+        {
+            static std::atomic<std::size_t> nextThread{0};
+            thread_local std::size_t const shard = nextThread.fetch_add(1, std::memory_order_relaxed) % shardCount;
+            return shard;
+        }
+
+      private:
+        std::string name_;
+        std::uint64_t signatureId_;
+        std::vector<std::size_t> argumentBytes_;
+        std::array<Shard, shardCount> shards_{};
+    };
+
+    /**
+     * @brief The registry of the statistics of all instrumented functions, keyed by name and signature id.
+     */
+    class InstrumentationRegistry
+    {
+      public:
+        /**
+         * @brief The registry used by instrument. It is never destroyed, so that functions can be called during
+         * static destruction.
+         */
+        static InstrumentationRegistry& global()
+        {
+            static InstrumentationRegistry& registry = *new InstrumentationRegistry;
+            return registry;
+        }
+
+        /**
+         * @brief The statistics for the name and signature, created on first use. The reference stays valid.
+         */
+        CallStats& stats(std::string_view name, std::uint64_t signatureId, std::vector<std::size_t> argumentBytes)
+        {
+            std::lock_guard lock{mutex_};
+            for (auto const& stats : stats_)
+                if (stats->signatureId() == signatureId && stats->name() == name)
+                    return *stats;
+            return *stats_.emplace_back(
+                std::make_unique<CallStats>(std::string{name}, signatureId, std::move(argumentBytes)));
+        }
+
+        /**
+         * @brief The statistics of all registered functions.
+         */
+        std::vector<CallStatsSnapshot> snapshot() const
+        {
+            std::lock_guard lock{mutex_};
+            std::vector<CallStatsSnapshot> snapshots;
+            snapshots.reserve(stats_.size());
+            for (auto const& stats : stats_)
+                snapshots.push_back(stats->snapshot());
+            return snapshots;
+        }
+
+        /**
+         * @brief A text table with one line per function: name, calls, mean / p50 / p99 / max latency in nanoseconds
+         * and the argument sizes in bytes. Not async signal safe, dump it from a thread that waits for the signal.
+         */
+        std::string report() const
+        {
+            std::string report = "name calls mean_ns p50_ns p99_ns max_ns argument_bytes\n";
+            for (auto const& snapshot : snapshot())
+            {
+                auto const mean = snapshot.calls == 0 ? 0 : snapshot.totalNanoseconds / snapshot.calls;
+                report += snapshot.name + ' ' + std::to_string(snapshot.calls) + ' ' + std::to_string(mean) + ' ' +
+                    std::to_string(snapshot.latency.percentile(0.5)) + ' ' +
+                    std::to_string(snapshot.latency.percentile(0.99)) + ' ' +
+                    std::to_string(snapshot.latency.percentile(1.0)) + ' ';
+                for (std::size_t index = 0; index != snapshot.argumentBytes.size(); ++index)
+                {
+                    if (index != 0)
+                        report += ',';
+                    report += std::to_string(snapshot.argumentBytes[index]);
+                }
+                report += '\n';
+            }
+            return report;
+        }
+
+        /**
+         * @brief Sets the counters of all functions to zero, the registrations are kept.
+         */
+        void reset()
+        {
+            std::lock_guard lock{mutex_};
+            for (auto const& stats : stats_)
+                stats->reset();
+        }
+
+      private:
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<CallStats>> stats_;
+    };
+
+    namespace Detail
+    {
+        /// Records the time from construction to destruction, also when the call throws.
+        class CallTimer
+        {
+          public:
+            explicit CallTimer(CallStats& stats) noexcept
+                : stats_{stats}
+                , start_{std::chrono::steady_clock::now()}
+            {}
+
+            CallTimer(CallTimer const&) = delete;
+            CallTimer& operator=(CallTimer const&) = delete;
+
+            ~CallTimer()
+            {
+                auto const elapsed = std::chrono::steady_clock::now() - start_;
+                stats_.record(
+                    static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+
+          private:
+            CallStats& stats_;
+            std::chrono::steady_clock::time_point start_;
+        };
+
+        template <typename FunctionT>
+        std::vector<std::size_t> argumentBytesOf()
+        {
+            using Core = FunctionTraitsCore<FunctionT>;
+            return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                return std::vector<std::size_t>{sizeof(typename Core::template ArgumentDecayed<Indices>)...};
+            }(std::make_index_sequence<Core::arity>{});
+        }
+    }
+
+    inline namespace TRAITS_LIB_INSTRUMENTATION_NAMESPACE
+    {
+        /**
+         * @brief The callable returned by instrument: calls the function and records the call in its CallStats. With
+         * TRAITS_LIB_ENABLE_INSTRUMENTATION set to 0 it only holds the function and calls it.
+         *
+         * @tparam FunctionT The instrumented function.
+         */
+        template <typename FunctionT>
+        class Instrumented
+        {
+          public:
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+            Instrumented(FunctionT function, CallStats& stats)
+                : function_{std::move(function)}
+                , stats_{&stats}
+            {}
+
+            /**
+             * @brief The statistics the calls are recorded in.
+             */
+            CallStats& stats() const noexcept
+            {
+                return *stats_;
+            }
+#else
+            explicit Instrumented(FunctionT function)
+                : function_{std::move(function)}
+            {}
+#endif
+
+            template <typename... Args>
+            requires std::is_invocable_v<FunctionT&, Args...>
+            decltype(auto) operator()(Args&&... args) noexcept(std::is_nothrow_invocable_v<FunctionT&, Args...>)
+            {
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+                Detail::CallTimer timer{*stats_};
+#endif
+                return std::invoke(function_, std::forward<Args>(args)...);
+            }
+
+            template <typename... Args>
+            requires std::is_invocable_v<FunctionT const&, Args...>
+            decltype(auto) operator()(Args&&... args) const
+                noexcept(std::is_nothrow_invocable_v<FunctionT const&, Args...>)
+            {
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+                Detail::CallTimer timer{*stats_};
+#endif
+                return std::invoke(function_, std::forward<Args>(args)...);
+            }
+
+          private:
+            FunctionT function_;
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+            CallStats* stats_;
+#endif
+        };
+
+        /**
+         * @brief Wraps a function so that its calls are counted and their latencies are recorded in the global
+         * InstrumentationRegistry under the name and the signature id of the function, together with the sizes of the
+         * decayed argument types. Functions with equal name and signature share their statistics. With
+         * TRAITS_LIB_ENABLE_INSTRUMENTATION set to 0 nothing is registered or recorded.
+         *
+         * @param function A function, function pointer, member function pointer or function object with a unique call
+         * operator.
+         * @param name The name the statistics are reported under.
+         * @return Instrumented<F> The instrumented function.
+         */
+        template <typename FunctionT>
+        Instrumented<std::decay_t<FunctionT>> instrument(FunctionT&& function, [[maybe_unused]] std::string_view name)
+        {
+            using FunctionType = std::decay_t<FunctionT>;
+            static_assert(
+                Detail::HasFunctionTraits<FunctionType>,
+                "instrument requires a function with a unique signature, e.g. not a generic lambda.");
+#if TRAITS_LIB_ENABLE_INSTRUMENTATION
+            auto& stats = InstrumentationRegistry::global().stats(
+                name, signatureIdOf<FunctionType>, Detail::argumentBytesOf<FunctionType>());
+            return Instrumented<FunctionType>{std::forward<FunctionT>(function), stats};
+#else
+            return Instrumented<FunctionType>{std::forward<FunctionT>(function)};
+#endif
+        }
+    }
+}
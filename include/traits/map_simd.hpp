@@ -0,0 +1,95 @@
+#pragma once
+
+#include <traits/batch_invoke.hpp>
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if __has_include(<experimental/simd>)
+#    include <experimental/simd>
+#endif
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+#    define TRAITS_LIB_HAS_SIMD 1
+#else
+#    define TRAITS_LIB_HAS_SIMD 0
+#endif
+
+namespace Traits
+{
+    namespace Detail
+    {
+#if TRAITS_LIB_HAS_SIMD
+        template <typename T>
+        concept IsVectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+        /// The number of lanes mapSimd processes at once: the native vector width of the output type.
+        template <typename OutputT>
+        constexpr std::size_t simdLanes = std::experimental::native_simd<OutputT>::size();
+
+        template <std::size_t lanes, typename T>
+        using SimdPack = std::experimental::fixed_size_simd<std::remove_cv_t<T>, lanes>;
+
+        /**
+         * @brief True when the function can be invoked with simd packs of the column types and returns something
+         * convertible to a simd pack of the output type.
+         */
+        template <typename FunctionT, typename OutputT, typename... ColumnTs>
+        concept IsSimdInvocable = IsVectorizable<OutputT> && (IsVectorizable<std::remove_cv_t<ColumnTs>> && ...) &&
+            std::is_invocable_v<FunctionT&, SimdPack<simdLanes<OutputT>, ColumnTs>...> &&
+            std::is_convertible_v<
+                std::invoke_result_t<FunctionT&, SimdPack<simdLanes<OutputT>, ColumnTs>...>,
+                SimdPack<simdLanes<OutputT>, OutputT>>;
+#else
+        template <typename FunctionT, typename OutputT, typename... ColumnTs>
+        concept IsSimdInvocable = false;
+#endif
+    }
+
+    /**
+     * @brief Invokes a (generic) function once per row of the given columns like invokeBatch, but with
+     * std::experimental::simd packs of the native width when the function can be invoked with them. The remaining rows
+     * (and all rows when the function only accepts scalars or simd is not available) are processed with scalars.
+     * The scalar invocation is checked with FunctionTraitsFor, its result must be convertible to the output type.
+     *
+     * Whether the function accepts simd packs is detected from its signature: constrain generic lambdas or give them
+     * an explicit return type if their body is not valid for simd packs, otherwise the check is a hard error.
+     *
+     * @param function The function to invoke, it is invoked as lvalue.
+     * @param output The output column.
+     * @param columns One input column per argument of the function.
+     * @throws std::length_error when the columns do not all have the same length.
+     */
+    template <typename FunctionT, typename OutputT, typename... ColumnTs>
+    void mapSimd(FunctionT&& function, std::span<OutputT> output, std::span<ColumnTs>... columns)
+    {
+        using Scalar = FunctionTraitsFor<FunctionT, std::remove_cv_t<ColumnTs> const&...>;
+        static_assert(!std::is_const_v<OutputT>, "The output column must be writable.");
+        static_assert(
+            std::is_convertible_v<typename Scalar::ReturnType, OutputT>,
+            "The result of the function must be convertible to the output type.");
+
+        auto const count = Detail::checkBatchSizes(output, columns...);
+        std::size_t row = 0;
+
+#if TRAITS_LIB_HAS_SIMD
+        if constexpr (Detail::IsSimdInvocable<std::remove_reference_t<FunctionT>, OutputT, ColumnTs...>)
+        {
+            constexpr auto lanes = Detail::simdLanes<OutputT>;
+            using OutputPack = Detail::SimdPack<lanes, OutputT>;
+            for (; row + lanes <= count; row += lanes)
+            {
+                OutputPack result =
+                    function(Detail::SimdPack<lanes, ColumnTs>{
+                        columns.data() + row, std::experimental::element_aligned}...);
+                result.copy_to(output.data() + row, std::experimental::element_aligned);
+            }
+        }
+#endif
+
+        Detail::invokeBatchLoop(
+            function, count - row, output.data() + row, static_cast<ColumnTs const*>(columns.data() + row)...);
+    }
+}
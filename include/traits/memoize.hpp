@@ -0,0 +1,203 @@
+#pragma once
+
+#include <traits/call_key.hpp>
+#include <traits/functions_core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Traits
+{
+    /**
+     * @brief The callable returned by memoize: caches the results of a function keyed by its decayed arguments. The
+     * cache is split into shards with one lock each (lock striping), every shard evicts with the CLOCK algorithm
+     * (an approximation of LRU that does not reorder entries on hits).
+     *
+     * @tparam FunctionT The memoized function.
+     */
+    template <typename FunctionT>
+    class Memoized
+    {
+      public:
+        using KeyType = Detail::CallKeyOf<FunctionT>;
+        using ValueType = std::remove_cvref_t<typename FunctionTraitsCore<FunctionT>::ReturnType>;
+
+        Memoized(FunctionT function, std::size_t capacity, std::size_t shardCount)
+            : function_{std::move(function)}
+            , shardCount_{std::max<std::size_t>(shardCount, 1)}
+            , shards_{std::make_unique<Shard[]>(shardCount_)}
+        {
+            auto const shardCapacity = std::max<std::size_t>((capacity + shardCount_ - 1) / shardCount_, 1);
+            for (std::size_t index = 0; index != shardCount_; ++index)
+                shards_[index].reserve(shardCapacity);
+        }
+
+        /**
+         * @brief Returns the cached result for the arguments or calls the function and caches its result. The
+         * function is called without holding a lock, concurrent misses for the same key may call it more than once.
+         * Arguments are looked up without constructing the key, e.g. a std::string_view for a std::string key.
+         */
+        template <typename... Args>
+        requires std::is_constructible_v<KeyType, Args const&...>
+        ValueType operator()(Args const&... args) const
+        {
+            auto const lookup = std::forward_as_tuple(args...);
+            auto const hash = Detail::KeyTupleHash<KeyType>{}(lookup);
+            auto& shard = shards_[(hash ^ (hash >> 29)) % shardCount_];
+
+            if (auto cached = shard.find(lookup))
+                return *std::move(cached);
+
+            // The function is called with the key instead of the arguments, which are only required to be comparable.
+            auto key = std::make_from_tuple<KeyType>(lookup);
+            ValueType value = Detail::invokeWithKey(function_, key);
+            shard.insert(std::move(key), value);
+            return value;
+        }
+
+        /**
+         * @brief The number of cached results.
+         */
+        std::size_t size() const
+        {
+            std::size_t size = 0;
+            for (std::size_t index = 0; index != shardCount_; ++index)
+                size += shards_[index].size();
+            return size;
+        }
+
+        /**
+         * @brief Removes all cached results.
+         */
+        void clear()
+        {
+            for (std::size_t index = 0; index != shardCount_; ++index)
+                shards_[index].clear();
+        }
+
+      private:
+        class Shard
+        {
+          public:
+            void reserve(std::size_t capacity)
+            {
+                capacity_ = capacity;
+                // The map never holds more than capacity entries (insert evicts first), so with this reservation it
+                // never rehashes and the iterators in the clock stay valid.
+                entries_.reserve(capacity);
+                clock_.reserve(capacity);
+            }
+
+            template <typename LookupT>
+            std::optional<ValueType> find(LookupT const& lookup) const
+            {
+                std::lock_guard lock{mutex_};
+                auto iterator = entries_.find(lookup);
+                if (iterator == entries_.end())
+                    return std::nullopt;
+                iterator->second.referenced = true;
+                return iterator->second.value;
+            }
+
+            void insert(KeyType key, ValueType const& value)
+            {
+                std::lock_guard lock{mutex_};
+                if (entries_.find(key) != entries_.end())
+                    return;
+
+                if (clock_.size() < capacity_)
+                {
+                    clock_.push_back(entries_.try_emplace(std::move(key), Entry{.value = value}).first);
+                    return;
+                }
+
+                // Second chance: skip (and clear) referenced entries, evict the first unreferenced one.
+                while (clock_[hand_]->second.referenced)
+                {
+                    clock_[hand_]->second.referenced = false;
+                    hand_ = (hand_ + 1) % capacity_;
+                }
+
+                auto& slot = clock_[hand_];
+                entries_.erase(slot);
+                try
+                {
+                    slot = entries_.try_emplace(std::move(key), Entry{.value = value}).first;
+                }
+                catch (...)
+                {
+                    // The slot refers to the erased entry, drop it from the clock.
+                    slot = clock_.back();
+                    clock_.pop_back();
+                    hand_ = 0;
+                    throw;
+                }
+                hand_ = (hand_ + 1) % capacity_;
+            }
+
+            std::size_t size() const
+            {
+                std::lock_guard lock{mutex_};
+                return entries_.size();
+            }
+
+            void clear()
+            {
+                std::lock_guard lock{mutex_};
+                clock_.clear();
+                entries_.clear();
+                hand_ = 0;
+            }
+
+          private:
+            struct Entry
+            {
+                ValueType value;
+                mutable bool referenced = false;
+            };
+
+            using Map =
+                std::unordered_map<KeyType, Entry, Detail::KeyTupleHash<KeyType>, Detail::KeyTupleEqual<KeyType>>;
+
+            mutable std::mutex mutex_;
+            Map entries_;
+            std::vector<typename Map::iterator> clock_;
+            std::size_t capacity_ = 1;
+            std::size_t hand_ = 0;
+        };
+
+      private:
+        FunctionT function_;
+        std::size_t shardCount_;
+        std::unique_ptr<Shard[]> shards_;
+    };
+
+    /**
+     * @brief Wraps a function into a thread safe cache of its results, keyed by ArgsTupleDecayed (with
+     * std::string_view stored as std::string). Only functions that can be called as const (they are shared between
+     * threads) and return a value are accepted.
+     *
+     * @param function The function to memoize.
+     * @param capacity The maximum number of cached results.
+     * @param shardCount The number of independently locked shards.
+     * @return Memoized<F> The memoized function.
+     */
+    template <typename FunctionT>
+    Memoized<std::decay_t<FunctionT>> memoize(FunctionT&& function, std::size_t capacity, std::size_t shardCount = 16)
+    {
+        using FunctionType = std::decay_t<FunctionT>;
+        using Core = FunctionTraitsCore<FunctionType>;
+        static_assert(
+            Core::qualifiers.isConst || !Detail::IsFunctionObject<FunctionType>,
+            "memoize requires a const callable, the function is shared between threads.");
+        static_assert(!std::is_void_v<typename Core::ReturnType>, "memoize requires a function with a result.");
+        return Memoized<FunctionType>{std::forward<FunctionT>(function), capacity, shardCount};
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+/// The largest trivially copyable type that OptimalParam passes by value, in bytes. Defaults to what the platform ABI
+/// passes in registers: 8 bytes on Windows x64, two registers elsewhere (System V x86-64, AArch64). Define it before
+/// including this header to override it for all wrappers, or pass a threshold to the aliases for a single one.
+#ifndef TRAITS_LIB_BY_VALUE_THRESHOLD
+#    if defined(_WIN64)
+#        define TRAITS_LIB_BY_VALUE_THRESHOLD sizeof(void*)
+#    else
+#        define TRAITS_LIB_BY_VALUE_THRESHOLD (2 * sizeof(void*))
+#    endif
+#endif
+
+namespace Traits
+{
+    /// The default threshold of OptimalParamType, see TRAITS_LIB_BY_VALUE_THRESHOLD.
+    constexpr std::size_t defaultByValueThreshold = TRAITS_LIB_BY_VALUE_THRESHOLD;
+
+    /**
+     * @brief The cheapest way to pass a T to a forwarding wrapper that only reads it: trivially copyable types that fit
+     * into the threshold are passed by value, everything else by const reference. T is decayed first.
+     *
+     * @tparam T The parameter type.
+     * @tparam threshold The largest size in bytes that is passed by value.
+     */
+    template <typename T, std::size_t threshold = defaultByValueThreshold>
+    using OptimalParamType = std::conditional_t<
+        std::is_trivially_copyable_v<std::decay_t<T>> && sizeof(std::decay_t<T>) <= threshold,
+        std::decay_t<T>,
+        std::decay_t<T> const&>;
+
+    /**
+     * @brief The N-th argument of a function as OptimalParamType.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     * @tparam N The index of the argument.
+     * @tparam threshold The largest size in bytes that is passed by value.
+     */
+    template <typename FunctionT, std::size_t N, std::size_t threshold = defaultByValueThreshold>
+    using OptimalParamOf =
+        OptimalParamType<typename FunctionTraitsCore<FunctionT>::template Argument<N>, threshold>;
+
+    namespace Detail
+    {
+        template <typename TypeListT, std::size_t threshold>
+        struct OptimalTypeList;
+
+        template <typename... Args, std::size_t threshold>
+        struct OptimalTypeList<TypeList<Args...>, threshold>
+        {
+            using type = TypeList<OptimalParamType<Args, threshold>...>;
+        };
+    }
+
+    /**
+     * @brief The arguments of a function as a TypeList of OptimalParamType.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     * @tparam threshold The largest size in bytes that is passed by value.
+     */
+    template <typename FunctionT, std::size_t threshold = defaultByValueThreshold>
+    using OptimalArgsTypeListOf =
+        typename Detail::OptimalTypeList<typename FunctionTraitsCore<FunctionT>::ArgsTypeList, threshold>::type;
+
+    /**
+     * @brief The arguments of a function as a std::tuple of OptimalParamType, e.g. for storing the parameters of a
+     * forwarding wrapper.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     * @tparam threshold The largest size in bytes that is passed by value.
+     */
+    template <typename FunctionT, std::size_t threshold = defaultByValueThreshold>
+    using OptimalArgsTupleOf = typename OptimalArgsTypeListOf<FunctionT, threshold>::template Apply<std::tuple>;
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <traits/batch_invoke.hpp>
+#include <traits/function_pointer.hpp>
+#include <traits/functions_core.hpp>
+#include <traits/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <latch>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Traits
+{
+    /**
+     * @brief Thrown by the parallel algorithms when more than one task failed, holds all exceptions.
+     */
+    class AggregateException : public std::exception
+    {
+      public:
+        explicit AggregateException(std::vector<std::exception_ptr> exceptions)
+            : exceptions_{std::move(exceptions)}
+        {}
+
+        char const* what() const noexcept override
+        {
+            return "Multiple tasks failed, see exceptions()";
+        }
+
+        /**
+         * @brief All exceptions that were thrown by the tasks.
+         */
+        std::vector<std::exception_ptr> const& exceptions() const noexcept
+        {
+            return exceptions_;
+        }
+
+      private:
+        std::vector<std::exception_ptr> exceptions_;
+    };
+
+    /**
+     * @brief Options of parallelInvokeBatch.
+     */
+    struct ParallelBatchOptions
+    {
+        /// The number of bytes (inputs and output) one chunk of rows should touch, keep it below the L2 cache size.
+        std::size_t chunkBytes = 64 * 1024;
+
+        /// The pool to run on, the default pool when nullptr.
+        WorkStealingPool* pool = nullptr;
+    };
+
+    namespace Detail
+    {
+        /**
+         * @brief Collects the exceptions of parallel tasks. For noexcept functions this is empty and never touched.
+         */
+        template <bool isNoexcept>
+        struct ExceptionCollector
+        {
+            std::mutex mutex;
+            std::vector<std::exception_ptr> exceptions;
+
+            void add(std::exception_ptr exception)
+            {
+                std::lock_guard lock{mutex};
+                exceptions.push_back(std::move(exception));
+            }
+
+            void rethrow()
+            {
+                if (exceptions.size() == 1)
+                    std::rethrow_exception(exceptions.front());
+                if (exceptions.size() > 1)
+                    throw AggregateException{std::move(exceptions)};
+            }
+        };
+
+        template <>
+        struct ExceptionCollector<true>
+        {
+            void rethrow() noexcept
+            {}
+        };
+
+        /**
+         * @brief The state shared by the caller and the helper tasks of one parallelInvokeBatch call. Every
+         * participant takes the next chunk from an atomic counter until all chunks are taken.
+         */
+        template <typename FunctionT, typename OutputT, typename... ColumnTs>
+        struct ParallelBatch
+        {
+            constexpr static bool isNoexcept = FunctionTraitsCore<FunctionT>::qualifiers.isNoexcept;
+
+            FunctionT const& function;
+            std::size_t count;
+            std::size_t chunkRows;
+            OutputT* output;
+            std::tuple<ColumnTs const*...> columns;
+            std::latch helpersDone;
+            std::atomic<std::size_t> nextRow{0};
+            ExceptionCollector<isNoexcept> errors{};
+
+            void runChunks() noexcept(isNoexcept)
+            {
+                // Stateless functions may have a non const call operator, every participant uses its own instance.
+                using CallableType = std::conditional_t<IsStateless<FunctionT>, FunctionT, FunctionT const&>;
+                CallableType callable = function;
+
+                while (true)
+                {
+                    auto const begin = nextRow.fetch_add(chunkRows, std::memory_order_relaxed);
+                    if (begin >= count)
+                        return;
+                    auto const rows = std::min(chunkRows, count - begin);
+
+                    std::apply(
+                        [&](auto const*... inputs) {
+                            invokeBatchLoop(callable, rows, output + begin, (inputs + begin)...);
+                        },
+                        columns);
+                }
+            }
+
+            void runChunksCollecting() noexcept
+            {
+                if constexpr (isNoexcept)
+                    runChunks();
+                else
+                {
+                    try
+                    {
+                        runChunks();
+                    }
+                    catch (...)
+                    {
+                        // Let the other participants stop early.
+                        nextRow.store(count, std::memory_order_relaxed);
+                        errors.add(std::current_exception());
+                    }
+                }
+            }
+        };
+    }
+
+    /**
+     * @brief Like invokeBatch, but splits the rows into chunks of about options.chunkBytes and runs them in parallel on
+     * a WorkStealingPool, the calling thread participates. Only functions that are safe to share between threads are
+     * accepted: function objects with a const call operator, stateless function objects, functions and function
+     * pointers. When the function is not noexcept, the first exception stops the remaining chunks and is rethrown;
+     * multiple exceptions are thrown as AggregateException. For noexcept functions no exception handling is generated.
+     *
+     * @param options The chunk size and the pool.
+     * @param function The function to invoke.
+     * @param output The output column.
+     * @param columns One input column per argument of the function.
+     * @throws std::length_error when the columns do not all have the same length.
+     */
+    template <typename FunctionT, typename OutputT, typename... ColumnTs>
+    void parallelInvokeBatch(
+        ParallelBatchOptions const& options,
+        FunctionT&& function,
+        std::span<OutputT> output,
+        std::span<ColumnTs>... columns)
+    {
+        using FunctionType = std::remove_cvref_t<FunctionT>;
+        using Core = FunctionTraitsCore<FunctionType>;
+        static_assert(
+            Core::qualifiers.isConst || IsStateless<FunctionType> || !Detail::IsFunctionObject<FunctionType>,
+            "parallelInvokeBatch shares the function between threads, it must be const callable or stateless.");
+        Detail::checkBatchSignature<FunctionType, OutputT, ColumnTs...>(std::index_sequence_for<ColumnTs...>{});
+        auto const count = Detail::checkBatchSizes(output, columns...);
+        if (count == 0)
+            return;
+
+        constexpr std::size_t rowBytes = sizeof(OutputT) + (std::size_t{0} + ... + sizeof(ColumnTs));
+        auto const chunkRows = std::max<std::size_t>(options.chunkBytes / rowBytes, 1);
+        auto& pool = options.pool != nullptr ? *options.pool : WorkStealingPool::defaultPool();
+
+        auto const chunks = (count + chunkRows - 1) / chunkRows;
+        auto const helpers = std::min(chunks, pool.size() + 1) - 1;
+
+        Detail::ParallelBatch<FunctionType, OutputT, ColumnTs...> batch{
+            .function = function,
+            .count = count,
+            .chunkRows = chunkRows,
+            .output = output.data(),
+            .columns = {static_cast<ColumnTs const*>(columns.data())...},
+            .helpersDone = std::latch{static_cast<std::ptrdiff_t>(helpers)},
+        };
+
+        std::size_t posted = 0;
+        try
+        {
+            for (; posted != helpers; ++posted)
+                pool.post([&batch]() noexcept {
+                    batch.runChunksCollecting();
+                    batch.helpersDone.count_down();
+                });
+        }
+        catch (...)
+        {
+            // Could not queue all helpers, the caller processes their chunks instead.
+            batch.helpersDone.count_down(static_cast<std::ptrdiff_t>(helpers - posted));
+        }
+
+        batch.runChunksCollecting();
+
+        // Help with other tasks of the pool while waiting, so that nested calls from within workers make progress.
+        // Once all queues are empty the helpers of this batch are running and blocking is safe.
+        while (!batch.helpersDone.try_wait())
+        {
+            if (!pool.runPendingTask())
+            {
+                batch.helpersDone.wait();
+                break;
+            }
+        }
+
+        batch.errors.rethrow();
+    }
+
+    /**
+     * @brief parallelInvokeBatch with the default options.
+     */
+    template <typename FunctionT, typename OutputT, typename... ColumnTs>
+    void parallelInvokeBatch(FunctionT&& function, std::span<OutputT> output, std::span<ColumnTs>... columns)
+    {
+        parallelInvokeBatch(
+            ParallelBatchOptions{}, std::forward<FunctionT>(function), output, std::span<ColumnTs>{columns}...);
+    }
+}
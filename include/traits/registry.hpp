@@ -0,0 +1,373 @@
+#pragma once
+
+#include <traits/function_pointer.hpp>
+#include <traits/functions_core.hpp>
+#include <traits/signature_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    template <typename SignatureT>
+    class RegistryHandle;
+
+    /**
+     * @brief A typed, non-owning handle to a callable stored in a Registry, two pointers wide. It is invalidated when
+     * the registry adds or erases entries (like iterators of flat hash tables).
+     *
+     * @tparam ReturnT The return type of the signature.
+     * @tparam Args The argument types of the signature.
+     */
+    template <typename ReturnT, typename... Args, bool isNoexcept>
+    class RegistryHandle<ReturnT(Args...) noexcept(isNoexcept)>
+    {
+      public:
+        using InvokerType = ReturnT (*)(void*, Args...) noexcept(isNoexcept);
+
+        RegistryHandle() noexcept = default;
+
+        RegistryHandle(void* object, InvokerType invoker) noexcept
+            : object_{object}
+            , invoker_{invoker}
+        {}
+
+        /**
+         * @brief Returns true if the handle refers to a callable.
+         */
+        explicit operator bool() const noexcept
+        {
+            return invoker_ != nullptr;
+        }
+
+        /**
+         * @brief Invokes the callable, the handle must not be empty.
+         */
+        ReturnT operator()(Args... args) const noexcept(isNoexcept)
+        {
+            return invoker_(object_, std::forward<Args>(args)...);
+        }
+
+      private:
+        void* object_ = nullptr;
+        InvokerType invoker_ = nullptr;
+    };
+
+    namespace Detail
+    {
+        /// The signature the registry keys callables by: only the noexcept qualifier is kept.
+        template <typename FunctionT>
+        using RegistrySignatureOf = std::remove_pointer_t<FunctionPointerOf<FunctionT>>;
+
+        inline std::uint64_t hashName(std::string_view name) noexcept
+        {
+            std::uint64_t hash = fnvOffsetBasis;
+            for (auto character : name)
+            {
+                hash ^= static_cast<unsigned char>(character);
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        template <typename CallableT, typename SignatureT>
+        struct RegistryInvoker;
+
+        template <typename CallableT, typename ReturnT, typename... Args, bool isNoexcept>
+        struct RegistryInvoker<CallableT, ReturnT(Args...) noexcept(isNoexcept)>
+        {
+            static ReturnT invoke(void* storage, Args... args) noexcept(isNoexcept)
+            {
+                return (*std::launder(static_cast<CallableT*>(storage)))(std::forward<Args>(args)...);
+            }
+        };
+    }
+
+    /**
+     * @brief Stores callables of different signatures by name. Every callable is registered with the signature
+     * FunctionTraits reports for it (only noexcept is kept, const is dropped) and can only be found with exactly that
+     * signature. The entries live inline in one open addressing table (linear probing), names and callables
+     * included, so neither registration nor lookup allocate nodes or strings. Lookups compare a 64 bit hash of name and
+     * signature, then the signature id with a single integer compare, then the name.
+     */
+    class Registry
+    {
+      public:
+        /// The maximum size of a stored callable in bytes.
+        constexpr static std::size_t inlineCapacity = 6 * sizeof(void*);
+
+        /// The maximum length of a name in characters, names are stored inline in the table.
+        constexpr static std::size_t maxNameLength = 31;
+
+        Registry() = default;
+        Registry(Registry const&) = delete;
+        Registry& operator=(Registry const&) = delete;
+
+        Registry(Registry&& other) noexcept
+            : slots_{std::exchange(other.slots_, nullptr)}
+            , capacity_{std::exchange(other.capacity_, 0)}
+            , size_{std::exchange(other.size_, 0)}
+        {}
+
+        Registry& operator=(Registry&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                slots_ = std::exchange(other.slots_, nullptr);
+                capacity_ = std::exchange(other.capacity_, 0);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        ~Registry()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Stores a callable under the given name and its signature. The signature is determined with
+         * FunctionTraits, so generic lambdas are rejected at compile time.
+         *
+         * @param name The name of the callable, one name may be used for several signatures.
+         * @param function A function, function pointer or function object, which is moved (or copied) into the
+         * registry.
+         * @return false if a callable with this name and signature is already registered, the registry is unchanged.
+         * @throws std::length_error when the name is longer than maxNameLength.
+         */
+        template <typename FunctionT>
+        bool add(std::string_view name, FunctionT&& function)
+        {
+            using CallableType = std::decay_t<FunctionT>;
+            static_assert(
+                Detail::HasFunctionTraits<CallableType> && !std::is_member_function_pointer_v<CallableType>,
+                "Only functions and function objects with a unique call operator can be registered.");
+            static_assert(sizeof(CallableType) <= inlineCapacity, "The callable is too large for the registry.");
+            static_assert(alignof(CallableType) <= alignof(std::max_align_t), "The callable is over-aligned.");
+            static_assert(
+                std::is_nothrow_move_constructible_v<CallableType>,
+                "Registered callables must be nothrow move constructible.");
+
+            if (name.size() > maxNameLength)
+                throw std::length_error("The name is too long for the registry.");
+
+            using SignatureType = Detail::RegistrySignatureOf<CallableType>;
+            constexpr auto signatureId = signatureIdOf<SignatureType>;
+            auto const hash = slotHash(name, signatureId);
+            if (findSlot(name, signatureId, hash) != nullptr)
+                return false;
+
+            reserve(size_ + 1);
+            Slot& slot = emptySlotFor(hash);
+            slot.assignName(name);
+            ::new (static_cast<void*>(slot.storage)) CallableType(std::forward<FunctionT>(function));
+            slot.hash = hash;
+            slot.signatureId = signatureId;
+            slot.invoker = reinterpret_cast<void (*)()>(&Detail::RegistryInvoker<CallableType, SignatureType>::invoke);
+            slot.manager = &manage<CallableType>;
+            ++size_;
+            return true;
+        }
+
+        /**
+         * @brief Looks up a callable by name and signature. Not const, the handle may invoke mutable callables.
+         *
+         * @tparam SignatureT The signature the callable was registered with, e.g. "int(double) noexcept".
+         * @return A handle to the callable, empty if there is no callable with this name and signature.
+         */
+        template <typename SignatureT>
+        RegistryHandle<Detail::RegistrySignatureOf<SignatureT>> find(std::string_view name) noexcept
+        {
+            using SignatureType = Detail::RegistrySignatureOf<SignatureT>;
+            using HandleType = RegistryHandle<SignatureType>;
+            constexpr auto signatureId = signatureIdOf<SignatureType>;
+
+            auto* slot = findSlot(name, signatureId, slotHash(name, signatureId));
+            if (slot == nullptr)
+                return {};
+            return HandleType{
+                static_cast<void*>(slot->storage), reinterpret_cast<typename HandleType::InvokerType>(slot->invoker)};
+        }
+
+        /**
+         * @brief Removes the callable with the given name and signature.
+         *
+         * @return true if a callable was removed.
+         */
+        template <typename SignatureT>
+        bool erase(std::string_view name) noexcept
+        {
+            constexpr auto signatureId = signatureIdOf<Detail::RegistrySignatureOf<SignatureT>>;
+            auto* slot = findSlot(name, signatureId, slotHash(name, signatureId));
+            if (slot == nullptr)
+                return false;
+
+            // Backward shift deletion: move following entries of the probe sequence into the gap, so no tombstones are
+            // needed.
+            auto gap = static_cast<std::size_t>(slot - slots_.get());
+            slot->destroy();
+            for (auto index = next(gap); slots_[index].manager != nullptr; index = next(index))
+            {
+                auto const home = slots_[index].hash & (capacity_ - 1);
+                if (((index - home) & (capacity_ - 1)) >= ((index - gap) & (capacity_ - 1)))
+                {
+                    slots_[gap].takeFrom(slots_[index]);
+                    gap = index;
+                }
+            }
+            --size_;
+            return true;
+        }
+
+        /**
+         * @brief Makes room for the given number of callables without rehashing. Rehashing invalidates all handles.
+         */
+        void reserve(std::size_t count)
+        {
+            // Keep the load factor at or below one half, linear probing degrades quickly above that.
+            if (count * 2 <= capacity_)
+                return;
+
+            std::size_t newCapacity = capacity_ == 0 ? 16 : capacity_;
+            while (count * 2 > newCapacity)
+                newCapacity *= 2;
+
+            auto oldSlots = std::exchange(slots_, std::make_unique<Slot[]>(newCapacity));
+            auto const oldCapacity = std::exchange(capacity_, newCapacity);
+            for (std::size_t index = 0; index != oldCapacity; ++index)
+            {
+                if (oldSlots[index].manager != nullptr)
+                    emptySlotFor(oldSlots[index].hash).takeFrom(oldSlots[index]);
+            }
+        }
+
+        /**
+         * @brief Removes all callables.
+         */
+        void clear() noexcept
+        {
+            for (std::size_t index = 0; index != capacity_; ++index)
+            {
+                if (slots_[index].manager != nullptr)
+                    slots_[index].destroy();
+            }
+            size_ = 0;
+        }
+
+        /**
+         * @brief The number of stored callables.
+         */
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+      private:
+        /// Move constructs the callable from source into destination and destroys the source. When destination is
+        /// nullptr the source is only destroyed.
+        using ManagerType = void (*)(void* destination, void* source) noexcept;
+
+        struct Slot
+        {
+            std::uint64_t hash = 0;
+            std::uint64_t signatureId = 0;
+            void (*invoker)() = nullptr;
+            ManagerType manager = nullptr;
+            std::uint8_t nameLength = 0;
+            char nameBuffer[maxNameLength];
+            alignas(std::max_align_t) std::byte storage[inlineCapacity];
+
+            Slot() = default;
+            Slot(Slot const&) = delete;
+            Slot& operator=(Slot const&) = delete;
+
+            ~Slot()
+            {
+                if (manager != nullptr)
+                    destroy();
+            }
+
+            void destroy() noexcept
+            {
+                manager(nullptr, storage);
+                manager = nullptr;
+                invoker = nullptr;
+            }
+
+            std::string_view name() const noexcept
+            {
+                return {nameBuffer, nameLength};
+            }
+
+            void assignName(std::string_view newName) noexcept
+            {
+                nameLength = static_cast<std::uint8_t>(newName.copy(nameBuffer, maxNameLength));
+            }
+
+            void takeFrom(Slot& other) noexcept
+            {
+                other.manager(storage, other.storage);
+                hash = other.hash;
+                signatureId = other.signatureId;
+                invoker = std::exchange(other.invoker, nullptr);
+                manager = std::exchange(other.manager, nullptr);
+                assignName(other.name());
+            }
+        };
+
+        template <typename CallableT>
+        static void manage(void* destination, void* source) noexcept
+        {
+            auto* callable = std::launder(static_cast<CallableT*>(source));
+            if (destination != nullptr)
+                ::new (destination) CallableT(std::move(*callable));
+            callable->~CallableT();
+        }
+
+        static std::uint64_t slotHash(std::string_view name, std::uint64_t signatureId) noexcept
+        {
+            auto hash = Detail::hashCombine(Detail::hashName(name), signatureId);
+            // Mix the high bits into the low bits, the table index only uses the latter.
+            return hash ^ (hash >> 32);
+        }
+
+        std::size_t next(std::size_t index) const noexcept
+        {
+            return (index + 1) & (capacity_ - 1);
+        }
+
+        Slot* findSlot(std::string_view name, std::uint64_t signatureId, std::uint64_t hash) const noexcept
+        {
+            if (capacity_ == 0)
+                return nullptr;
+
+            for (auto index = hash & (capacity_ - 1); slots_[index].manager != nullptr; index = next(index))
+            {
+                auto& slot = slots_[index];
+                if (slot.hash == hash && slot.signatureId == signatureId && slot.name() == name)
+                    return &slot;
+            }
+            return nullptr;
+        }
+
+        Slot& emptySlotFor(std::uint64_t hash) noexcept
+        {
+            auto index = hash & (capacity_ - 1);
+            while (slots_[index].manager != nullptr)
+                index = next(index);
+            return slots_[index];
+        }
+
+      private:
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t capacity_ = 0;
+        std::size_t size_ = 0;
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        constexpr std::uint64_t fnvOffsetBasis = 14695981039346656037ull;
+        constexpr std::uint64_t fnvPrime = 1099511628211ull;
+
+        constexpr std::uint64_t hashCombine(std::uint64_t hash, std::uint64_t value) noexcept
+        {
+            for (int byte = 0; byte != 8; ++byte)
+            {
+                hash ^= (value >> (byte * 8)) & 0xff;
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        /**
+         * @brief A hash of the type T that does not need RTTI: FNV-1a over the compiler generated signature of this
+         * function, which spells out T. It is the same in every translation unit built by the same compiler.
+         */
+        template <typename T>
+        constexpr std::uint64_t typeHash() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            constexpr char const* name = __FUNCSIG__;
+#else
+            constexpr char const* name = __PRETTY_FUNCTION__;
+#endif
+            std::uint64_t hash = fnvOffsetBasis;
+            for (auto const* character = name; *character != '\0'; ++character)
+            {
+                hash ^= static_cast<unsigned char>(*character);
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        template <typename SignatureT, FunctionQualifiers qualifiers>
+        struct SignatureKey;
+
+        template <typename ReturnT, typename... Args, FunctionQualifiers qualifiers>
+        struct SignatureKey<ReturnT(Args...), qualifiers>
+        {
+            constexpr static std::uint64_t qualifierBits = (qualifiers.isConst ? 1u : 0u) |
+                (qualifiers.isVolatile ? 2u : 0u) | (qualifiers.isReferenceQualified ? 4u : 0u) |
+                (qualifiers.isRvalueReferenceQualified ? 8u : 0u) | (qualifiers.isNoexcept ? 16u : 0u);
+
+            constexpr static std::uint64_t id = [] {
+                auto hash = hashCombine(fnvOffsetBasis, typeHash<ReturnT>());
+                ((hash = hashCombine(hash, typeHash<Args>())), ...);
+                hash = hashCombine(hash, sizeof...(Args));
+                return hashCombine(hash, qualifierBits);
+            }();
+        };
+
+        /// Identifies a signature by its return type, argument types and qualifiers, the class type is ignored.
+        template <typename FunctionT>
+        using SignatureKeyOf =
+            SignatureKey<typename FunctionTraitsCore<FunctionT>::Signature, FunctionTraitsCore<FunctionT>::qualifiers>;
+
+        template <typename FunctionT, typename... Others>
+        constexpr bool collidesWithAny =
+            ((SignatureKeyOf<FunctionT>::id == SignatureKeyOf<Others>::id &&
+              !std::is_same_v<SignatureKeyOf<FunctionT>, SignatureKeyOf<Others>>) ||
+             ...);
+    }
+
+    /**
+     * @brief A 64 bit hash of the signature of a function computed at compile time without RTTI. It covers the return
+     * type, every argument type and the qualifiers (not the class of member functions) and is the same in all
+     * translation units built with the same compiler. Use signatureIdsAreUnique to rule out collisions.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     */
+    template <typename FunctionT>
+    constexpr std::uint64_t signatureIdOf = Detail::SignatureKeyOf<FunctionT>::id;
+
+    /**
+     * @brief True when no two different signatures in the set share a signatureIdOf. Functions with the same signature
+     * may appear more than once. Meant for static_asserts next to dispatch tables keyed by signature id.
+     *
+     * @tparam FunctionTs Function, function pointer, member function pointer or function object types.
+     */
+    template <typename... FunctionTs>
+    constexpr bool signatureIdsAreUnique = true;
+
+    template <typename FunctionT, typename... FunctionTs>
+    constexpr bool signatureIdsAreUnique<FunctionT, FunctionTs...> =
+        !Detail::collidesWithAny<FunctionT, FunctionTs...> && signatureIdsAreUnique<FunctionTs...>;
+}
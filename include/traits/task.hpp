@@ -0,0 +1,449 @@
+#pragma once
+
+#include <traits/awaitable.hpp>
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    /**
+     * @brief Recycles coroutine frames. Frames up to maxPooledSize bytes are rounded up to a multiple of granularity
+     * and kept in per thread free lists, so in steady state starting a coroutine does not call the global operator
+     * new. A frame may be released on another thread than the one that allocated it, it is cached there then. Larger
+     * frames and frames beyond maxCachedPerClass go to the global operator new and delete.
+     */
+    class CoroutineFramePool
+    {
+      public:
+        constexpr static std::size_t granularity = 64;
+        constexpr static std::size_t classCount = 16;
+        constexpr static std::size_t maxPooledSize = granularity * classCount;
+        constexpr static std::size_t maxCachedPerClass = 64;
+
+        static void* allocate(std::size_t size)
+        {
+            if (size > maxPooledSize)
+                return ::operator new(size);
+
+            auto const sizeClass = classOf(size);
+            if (auto* cache = localCache(); cache != nullptr && cache->lists[sizeClass] != nullptr)
+            {
+                auto* block = cache->lists[sizeClass];
+                cache->lists[sizeClass] = block->next;
+                --cache->counts[sizeClass];
+                return block;
+            }
+            return ::operator new((sizeClass + 1) * granularity);
+        }
+
+        /**
+         * @brief Releases a frame, size must be the one it was allocated with.
+         */
+        static void deallocate(void* frame, std::size_t size) noexcept
+        {
+            if (size <= maxPooledSize)
+            {
+                auto const sizeClass = classOf(size);
+                if (auto* cache = localCache(); cache != nullptr && cache->counts[sizeClass] != maxCachedPerClass)
+                {
+                    cache->lists[sizeClass] = ::new (frame) FreeBlock{cache->lists[sizeClass]};
+                    ++cache->counts[sizeClass];
+                    return;
+                }
+            }
+            ::operator delete(frame);
+        }
+
+        /**
+         * @brief The number of frames cached by the calling thread.
+         */
+        static std::size_t cachedFrames() noexcept
+        {
+            std::size_t count = 0;
+            if (auto* cache = localCache(); cache != nullptr)
+                for (auto const cached : cache->counts)
+                    count += cached;
+            return count;
+        }
+
+      private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct LocalCache
+        {
+            bool& destroyed;
+            std::array<FreeBlock*, classCount> lists{};
+            std::array<std::size_t, classCount> counts{};
+
+            ~LocalCache()
+            {
+                destroyed = true;
+                for (auto* block : lists)
+                    while (block != nullptr)
+                        ::operator delete(std::exchange(block, block->next));
+            }
+        };
+
+        constexpr static std::size_t classOf(std::size_t size) noexcept
+        {
+            return size == 0 ? 0 : (size - 1) / granularity;
+        }
+
+        /// Null while the thread exits, frames released after its cache was destroyed bypass it.
+        static LocalCache* localCache() noexcept
+        {
+            thread_local bool destroyed = false;
+            if (destroyed)
+                return nullptr;
+            thread_local LocalCache cache{destroyed};
+            return &cache;
+        }
+    };
+
+    /**
+     * @brief A base for promise types that allocates the coroutine frames from the CoroutineFramePool: the compiler
+     * uses the operator new and delete of the promise type for the frame.
+     */
+    struct PooledCoroutineFrame
+    {
+        static void* operator new(std::size_t size)
+        {
+            return CoroutineFramePool::allocate(size);
+        }
+
+        static void operator delete(void* frame, std::size_t size) noexcept
+        {
+            CoroutineFramePool::deallocate(frame, size);
+        }
+    };
+
+    template <typename ValueT = void>
+    class Task;
+
+    namespace Detail
+    {
+        struct TaskPromiseBase : public PooledCoroutineFrame
+        {
+            /// Resumes the awaiting coroutine when the task is done (symmetric transfer, no stack growth).
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename PromiseT>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) const noexcept
+                {
+                    return handle.promise().continuation;
+                }
+
+                void await_resume() const noexcept
+                {}
+            };
+
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+            std::exception_ptr exception;
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+
+            void rethrowException() const
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+        };
+
+        template <typename ValueT>
+        struct TaskPromise : public TaskPromiseBase
+        {
+            std::optional<ValueT> value;
+
+            Task<ValueT> get_return_object() noexcept
+            {
+                return Task<ValueT>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+            }
+
+            template <typename OtherT = ValueT>
+            requires std::is_convertible_v<OtherT, ValueT>
+            void return_value(OtherT&& result) noexcept(std::is_nothrow_constructible_v<ValueT, OtherT>)
+            {
+                value.emplace(std::forward<OtherT>(result));
+            }
+
+            ValueT take()
+            {
+                rethrowException();
+                return *std::move(value);
+            }
+        };
+
+        template <>
+        struct TaskPromise<void> : public TaskPromiseBase
+        {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept
+            {}
+
+            void take() const
+            {
+                rethrowException();
+            }
+        };
+
+        template <typename ValueT>
+        struct TaskAwaiter
+        {
+            std::coroutine_handle<TaskPromise<ValueT>> handle;
+
+            bool await_ready() const noexcept
+            {
+                return handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) const noexcept
+            {
+                handle.promise().continuation = caller;
+                return handle;
+            }
+
+            ValueT await_resume() const
+            {
+                return handle.promise().take();
+            }
+        };
+    }
+
+    /**
+     * @brief A minimal lazy coroutine: it starts when it is awaited and resumes the awaiting coroutine directly when
+     * it is done. The frame comes from the CoroutineFramePool, so a steady stream of tasks does not allocate, and
+     * awaiting it is a direct call into the frame without any type erased adapter. Use syncWait to run a task from
+     * regular code.
+     *
+     * @tparam ValueT The result type, may be void.
+     */
+    template <typename ValueT>
+    class [[nodiscard]] Task
+    {
+        static_assert(
+            !std::is_reference_v<ValueT>, "Task results are values, return a pointer instead of a reference.");
+
+      public:
+        using promise_type = Detail::TaskPromise<ValueT>;
+
+        Task(Task&& other) noexcept
+            : handle_{std::exchange(other.handle_, {})}
+        {}
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~Task()
+        {
+            destroy();
+        }
+
+        /**
+         * @brief False for moved from tasks.
+         */
+        bool valid() const noexcept
+        {
+            return static_cast<bool>(handle_);
+        }
+
+        /**
+         * @brief Starts the task and suspends the caller until it is done, then yields its result or rethrows its
+         * exception. A task can be awaited once.
+         */
+        Detail::TaskAwaiter<ValueT> operator co_await() && noexcept
+        {
+            return Detail::TaskAwaiter<ValueT>{handle_};
+        }
+
+      private:
+        friend promise_type;
+
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+            : handle_{handle}
+        {}
+
+        void destroy() noexcept
+        {
+            if (handle_)
+                std::exchange(handle_, {}).destroy();
+        }
+
+      private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    namespace Detail
+    {
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept
+        {
+            return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+        }
+
+        /// A fire and forget coroutine that starts right away and frees its frame when it returns.
+        struct SyncWaitDriver
+        {
+            struct promise_type : public PooledCoroutineFrame
+            {
+                SyncWaitDriver get_return_object() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                void return_void() const noexcept
+                {}
+
+                void unhandled_exception() const noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+        /// The result of syncWait, lvalue references are kept as references.
+        template <typename AwaitedT>
+        using SyncWaitResult =
+            std::conditional_t<std::is_lvalue_reference_v<AwaitedT>, AwaitedT, std::remove_cvref_t<AwaitedT>>;
+
+        /**
+         * @brief Wakes the thread blocked in syncWait. The signal lives on the stack of that thread, which may return
+         * as soon as it observes done: set therefore stores and notifies while holding the mutex, and wait locks the
+         * mutex once more before returning, so the signal is not destroyed before set is done with it.
+         */
+        struct SyncWaitSignal
+        {
+            std::mutex mutex;
+            std::atomic<bool> done{false};
+
+            void set() noexcept
+            {
+                std::lock_guard lock{mutex};
+                done.store(true, std::memory_order_release);
+                done.notify_one();
+            }
+
+            void wait() noexcept
+            {
+                done.wait(false, std::memory_order_acquire);
+                std::lock_guard lock{mutex};
+            }
+        };
+
+        template <typename ResultT>
+        struct SyncWaitState
+        {
+            using StoredType = std::conditional_t<
+                std::is_lvalue_reference_v<ResultT>,
+                std::reference_wrapper<std::remove_reference_t<ResultT>>,
+                ResultT>;
+
+            std::optional<StoredType> value;
+            std::exception_ptr exception;
+            SyncWaitSignal signal;
+
+            ResultT take()
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+                return *std::move(value);
+            }
+        };
+
+        template <>
+        struct SyncWaitState<void>
+        {
+            std::exception_ptr exception;
+            SyncWaitSignal signal;
+
+            void take() const
+            {
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
+        };
+
+        template <typename ResultT, typename AwaitableT>
+        SyncWaitDriver driveSyncWait(AwaitableT&& awaitable, SyncWaitState<ResultT>& state)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<ResultT>)
+                    co_await std::forward<AwaitableT>(awaitable);
+                else
+                    state.value.emplace(co_await std::forward<AwaitableT>(awaitable));
+            }
+            catch (...)
+            {
+                state.exception = std::current_exception();
+            }
+            // The state belongs to the waiting thread, the frame only frees itself after this.
+            state.signal.set();
+        }
+    }
+
+    /**
+     * @brief Awaits an awaitable from regular code: blocks the calling thread until it is done, also when it is
+     * resumed on another thread, and returns its result or rethrows its exception.
+     *
+     * @param awaitable E.g. a Task or the result of invokeAsync.
+     * @return The awaited value, lvalue references are returned as references.
+     */
+    template <typename AwaitableT>
+    requires IsAwaitable<AwaitableT>
+    Detail::SyncWaitResult<AwaitedType<AwaitableT>> syncWait(AwaitableT&& awaitable)
+    {
+        using ResultType = Detail::SyncWaitResult<AwaitedType<AwaitableT>>;
+        Detail::SyncWaitState<ResultType> state;
+        Detail::driveSyncWait<ResultType>(std::forward<AwaitableT>(awaitable), state);
+        state.signal.wait();
+        return state.take();
+    }
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Traits
+{
+    /// The default size of a TaskQueue slot in bytes, chosen so that a slot (storage, sequence number and operation)
+    /// fills exactly one cache line.
+    constexpr std::size_t defaultTaskQueueSlotBytes = 64 - 2 * sizeof(void*);
+
+    template <typename SignatureT, std::size_t slotBytes = defaultTaskQueueSlotBytes>
+    class TaskQueue;
+
+    namespace Detail
+    {
+        /// Separates the producer and consumer positions of a queue, so they do not share a cache line, and aligns the
+        /// slots, so a slot does not straddle two cache lines.
+        constexpr std::size_t cacheLineSize = 64;
+
+        /**
+         * @brief The arguments and the result of one TaskQueue::tryRun call, passed to the stored operation.
+         */
+        template <typename ReturnT, typename... Args>
+        struct TaskInvocation
+        {
+            std::tuple<Args&&...> arguments;
+            std::optional<ReturnT> result{};
+
+            template <typename CallableT>
+            void invoke(CallableT& callable)
+            {
+                result.emplace(std::apply(callable, std::move(arguments)));
+            }
+        };
+
+        template <typename... Args>
+        struct TaskInvocation<void, Args...>
+        {
+            std::tuple<Args&&...> arguments;
+
+            template <typename CallableT>
+            void invoke(CallableT& callable)
+            {
+                std::apply(callable, std::move(arguments));
+            }
+        };
+
+        /**
+         * @brief The implementation of TaskQueue: a bounded ring buffer of slots with a sequence number each (Dmitry
+         * Vyukov's bounded queue), producers claim slots with a compare and swap on the tail, the single consumer owns
+         * the head.
+         */
+        template <bool isNoexcept, std::size_t slotBytes, typename ReturnT, typename... Args>
+        class TaskQueueImpl
+        {
+          private:
+            using Invocation = TaskInvocation<ReturnT, Args...>;
+
+            /// Invokes the stored callable and destroys it. When invocation is nullptr it is only destroyed.
+            using OperationType = void (*)(void* storage, Invocation* invocation) noexcept(isNoexcept);
+
+            template <typename CallableT>
+            constexpr static bool isCompatible = isNoexcept
+                ? std::is_nothrow_invocable_r_v<ReturnT, CallableT&, Args...>
+                : std::is_invocable_r_v<ReturnT, CallableT&, Args...>;
+
+            /// Aligned to and padded to whole cache lines (the slot array is allocated with the aligned operator new),
+            /// so producers writing neighbouring slots never share a cache line.
+            struct alignas(cacheLineSize) Slot
+            {
+                std::atomic<std::size_t> sequence;
+                OperationType operation;
+                alignas(std::max_align_t) std::byte storage[slotBytes];
+            };
+
+          public:
+            static_assert(
+                std::is_void_v<ReturnT> || std::is_object_v<ReturnT>,
+                "TaskQueue does not support signatures returning references.");
+
+            using ResultType = std::conditional_t<std::is_void_v<ReturnT>, bool, std::optional<ReturnT>>;
+
+            /**
+             * @brief Allocates all slots, no allocations happen afterwards.
+             *
+             * @param capacity The number of slots, rounded up to the next power of two.
+             */
+            explicit TaskQueueImpl(std::size_t capacity)
+                : mask_{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1}
+                , slots_{std::make_unique<Slot[]>(mask_ + 1)}
+            {
+                for (std::size_t index = 0; index <= mask_; ++index)
+                    slots_[index].sequence.store(index, std::memory_order_relaxed);
+            }
+
+            TaskQueueImpl(TaskQueueImpl const&) = delete;
+            TaskQueueImpl& operator=(TaskQueueImpl const&) = delete;
+
+            /**
+             * @brief Destroys the tasks that were not run. No producer may be pushing anymore.
+             */
+            ~TaskQueueImpl()
+            {
+                for (auto* slot = readySlot(); slot != nullptr; slot = readySlot())
+                {
+                    slot->operation(slot->storage, nullptr);
+                    release(*slot);
+                }
+            }
+
+            /**
+             * @brief Constructs the callable in the next free slot. May be called from any number of threads. Fails to
+             * compile if the callable does not match the signature or does not fit into a slot.
+             *
+             * @return false if the queue is full, the callable is not consumed then.
+             */
+            template <typename CallableT>
+            requires isCompatible<std::decay_t<CallableT>>
+            bool tryPush(CallableT&& callable) noexcept(
+                std::is_nothrow_constructible_v<std::decay_t<CallableT>, CallableT>)
+            {
+                using CallableType = std::decay_t<CallableT>;
+                static_assert(
+                    sizeof(CallableType) <= slotBytes,
+                    "The callable does not fit into a TaskQueue slot, increase slotBytes.");
+                static_assert(
+                    alignof(CallableType) <= alignof(std::max_align_t),
+                    "The callable is over-aligned for a TaskQueue slot.");
+
+                auto position = tail_.load(std::memory_order_relaxed);
+                Slot* slot;
+                while (true)
+                {
+                    slot = &slots_[position & mask_];
+                    auto const sequence = slot->sequence.load(std::memory_order_acquire);
+                    auto const difference = static_cast<std::ptrdiff_t>(sequence - position);
+                    if (difference == 0)
+                    {
+                        if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (difference < 0)
+                        return false;
+                    else
+                        position = tail_.load(std::memory_order_relaxed);
+                }
+
+                struct Unclaim
+                {
+                    Slot* slot;
+                    std::size_t position;
+
+                    // Publishes an empty slot if the construction throws, the consumer skips it.
+                    ~Unclaim()
+                    {
+                        if (slot != nullptr)
+                        {
+                            slot->operation = &skip;
+                            slot->sequence.store(position + 1, std::memory_order_release);
+                        }
+                    }
+                } unclaim{slot, position};
+
+                ::new (static_cast<void*>(slot->storage)) CallableType(std::forward<CallableT>(callable));
+                unclaim.slot = nullptr;
+                slot->operation = &operate<CallableType>;
+                slot->sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * @brief Runs (and destroys) the oldest task. Must only be called from the single consumer thread.
+             *
+             * @return Whether a task was run, or its result (std::nullopt if the queue was empty) for signatures that
+             * return a value.
+             */
+            ResultType tryRun(Args... args) noexcept(isNoexcept)
+            {
+                auto* slot = readySlot();
+                if (slot == nullptr)
+                    return ResultType{};
+
+                // The slot is handed back to the producers even when the task throws.
+                struct Release
+                {
+                    TaskQueueImpl& queue;
+                    Slot& slot;
+
+                    ~Release()
+                    {
+                        queue.release(slot);
+                    }
+                } releaseSlot{*this, *slot};
+
+                Invocation invocation{{std::forward<Args>(args)...}};
+                slot->operation(slot->storage, &invocation);
+                if constexpr (std::is_void_v<ReturnT>)
+                    return true;
+                else
+                    return std::move(invocation.result);
+            }
+
+            /**
+             * @brief The number of slots.
+             */
+            std::size_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+          private:
+            /// The slot at the head if its task is published, skipping slots whose construction failed.
+            Slot* readySlot() noexcept
+            {
+                while (true)
+                {
+                    auto& slot = slots_[head_ & mask_];
+                    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1)
+                        return nullptr;
+                    if (slot.operation != &skip)
+                        return &slot;
+                    release(slot);
+                }
+            }
+
+            void release(Slot& slot) noexcept
+            {
+                slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+                ++head_;
+            }
+
+            template <typename CallableT>
+            static void operate(void* storage, Invocation* invocation) noexcept(isNoexcept)
+            {
+                auto* callable = std::launder(static_cast<CallableT*>(storage));
+                struct Destroy
+                {
+                    CallableT* callable;
+
+                    ~Destroy()
+                    {
+                        callable->~CallableT();
+                    }
+                } destroy{callable};
+
+                if (invocation != nullptr)
+                    invocation->invoke(*callable);
+            }
+
+            static void skip(void*, Invocation*) noexcept
+            {}
+
+          private:
+            alignas(cacheLineSize) std::atomic<std::size_t> tail_{0};
+            alignas(cacheLineSize) std::size_t head_ = 0;
+            std::size_t mask_;
+            std::unique_ptr<Slot[]> slots_;
+        };
+    }
+
+    /**
+     * @brief A bounded, lock-free multi producer / single consumer queue of callables. Callables are constructed
+     * directly into fixed size slots and are invoked and destroyed by one function pointer per slot, so pushing and
+     * running a task neither allocates nor locks. Callables that do not match the signature or do not fit into a slot
+     * are rejected at compile time.
+     *
+     * @tparam ReturnT The return type of the signature.
+     * @tparam Args The argument types of the signature, passed to the task by the consumer.
+     * @tparam slotBytes The inline storage of a slot in bytes.
+     */
+    template <typename ReturnT, typename... Args, bool isNoexcept, std::size_t slotBytes>
+    class TaskQueue<ReturnT(Args...) noexcept(isNoexcept), slotBytes>
+        : public Detail::TaskQueueImpl<isNoexcept, slotBytes, ReturnT, Args...>
+    {
+      private:
+        using Impl = Detail::TaskQueueImpl<isNoexcept, slotBytes, ReturnT, Args...>;
+
+      public:
+        using Impl::Impl;
+    };
+
+    /**
+     * @brief The TaskQueue for callables with the call signature of a function, keeping its noexcept qualifier.
+     *
+     * @tparam FunctionT A function, function pointer, member function pointer or function object type.
+     * @tparam slotBytes The inline storage of a slot in bytes.
+     */
+    template <typename FunctionT, std::size_t slotBytes = defaultTaskQueueSlotBytes>
+    using TaskQueueOf = TaskQueue<
+        typename Detail::QualifiedSignature<
+            typename FunctionTraitsCore<FunctionT>::Signature,
+            false,
+            FunctionTraitsCore<FunctionT>::qualifiers.isNoexcept>::type,
+        slotBytes>;
+}
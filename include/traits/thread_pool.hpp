@@ -0,0 +1,557 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/inplace_function.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Traits
+{
+    class WorkStealingPool;
+
+    namespace Detail
+    {
+        struct NoException
+        {};
+
+        template <typename SlotT>
+        class ResultSlotArena;
+
+        /// The value of a ResultSlot, nothing for void functions.
+        template <typename ReturnT>
+        struct ResultValue
+        {
+            std::optional<ReturnT> value;
+
+            template <typename CallableT>
+            void compute(CallableT& callable)
+            {
+                value.emplace(callable());
+            }
+
+            ReturnT take()
+            {
+                return *std::move(value);
+            }
+        };
+
+        template <>
+        struct ResultValue<void>
+        {
+            template <typename CallableT>
+            void compute(CallableT& callable)
+            {
+                callable();
+            }
+
+            void take() noexcept
+            {}
+        };
+
+        /**
+         * @brief The result of one submitted task, shared by the task and its TaskResult. The exception is only
+         * stored for functions that may throw.
+         */
+        template <typename ReturnT, bool isNoexcept>
+        struct ResultSlot
+        {
+            constexpr static std::uint32_t pending = 0;
+            constexpr static std::uint32_t ready = 1;
+            constexpr static std::uint32_t abandoned = 2;
+
+            std::atomic<std::uint32_t> state{pending};
+            ResultValue<ReturnT> result;
+            [[no_unique_address]] std::conditional_t<isNoexcept, NoException, std::exception_ptr> exception;
+            ResultSlot* next = nullptr;
+
+            /// Stores the result of the callable, the last one of task and handle recycles the slot.
+            template <typename CallableT>
+            void run(CallableT& callable) noexcept
+            {
+                if constexpr (isNoexcept)
+                    result.compute(callable);
+                else
+                {
+                    try
+                    {
+                        result.compute(callable);
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+
+                if (state.exchange(ready, std::memory_order_acq_rel) == abandoned)
+                    ResultSlotArena<ResultSlot>::release(this);
+                else
+                    // The slot may be recycled before the notification, which is harmless: slots are never freed and
+                    // waiters check the state again.
+                    state.notify_all();
+            }
+
+            void reset() noexcept
+            {
+                if constexpr (!std::is_void_v<ReturnT>)
+                    result.value.reset();
+                if constexpr (!isNoexcept)
+                    exception = nullptr;
+                state.store(pending, std::memory_order_relaxed);
+            }
+        };
+
+        /**
+         * @brief Hands out ResultSlots from chunks that are allocated once and never freed. Every thread keeps its own
+         * free list of at most localLimit slots: beyond that a batch of chunkSize slots is moved to a shared list, so
+         * slots released on other threads than they were acquired on (e.g. abandoned results) are reused instead of
+         * piling up. The local list is returned to the shared list when the thread exits.
+         */
+        template <typename SlotT>
+        class ResultSlotArena
+        {
+          public:
+            constexpr static std::size_t chunkSize = 64;
+            constexpr static std::size_t localLimit = 2 * chunkSize;
+
+            static SlotT* acquire()
+            {
+                auto& local = localList();
+                if (local.head == nullptr)
+                    local.head = shared().takeAll(local.size);
+                auto* slot = local.head;
+                local.head = slot->next;
+                --local.size;
+                return slot;
+            }
+
+            static void release(SlotT* slot) noexcept
+            {
+                slot->reset();
+                auto& local = localList();
+                slot->next = local.head;
+                local.head = slot;
+                if (++local.size < localLimit)
+                    return;
+
+                auto* first = local.head;
+                auto* last = first;
+                for (std::size_t index = 1; index != chunkSize; ++index)
+                    last = last->next;
+                local.head = std::exchange(last->next, nullptr);
+                local.size -= chunkSize;
+                shared().giveAll(first, last, chunkSize);
+            }
+
+            /**
+             * @brief The number of chunks allocated so far.
+             */
+            static std::size_t chunkCount()
+            {
+                auto& instance = shared();
+                std::lock_guard lock{instance.mutex};
+                return instance.chunks.size();
+            }
+
+          private:
+            struct Shared
+            {
+                std::mutex mutex;
+                SlotT* head = nullptr;
+                std::size_t size = 0;
+                std::vector<std::unique_ptr<SlotT[]>> chunks;
+
+                /// Takes the whole shared free list or a new chunk if it is empty, count is set to the number of slots.
+                SlotT* takeAll(std::size_t& count)
+                {
+                    std::lock_guard lock{mutex};
+                    if (head == nullptr)
+                    {
+                        chunks.reserve(chunks.size() + 1);
+                        auto& chunk = chunks.emplace_back(std::make_unique<SlotT[]>(chunkSize));
+                        for (std::size_t index = 0; index + 1 != chunkSize; ++index)
+                            chunk[index].next = &chunk[index + 1];
+                        head = &chunk[0];
+                        size = chunkSize;
+                    }
+                    count = std::exchange(size, 0);
+                    return std::exchange(head, nullptr);
+                }
+
+                void giveAll(SlotT* first, SlotT* last, std::size_t count) noexcept
+                {
+                    std::lock_guard lock{mutex};
+                    last->next = head;
+                    head = first;
+                    size += count;
+                }
+            };
+
+            struct LocalList
+            {
+                SlotT* head = nullptr;
+                std::size_t size = 0;
+
+                ~LocalList()
+                {
+                    if (head == nullptr)
+                        return;
+                    auto* last = head;
+                    while (last->next != nullptr)
+                        last = last->next;
+                    shared().giveAll(head, last, size);
+                }
+            };
+
+            /// Never destroyed, so that threads exiting during static destruction can still return their slots and
+            /// late notifications on a released slot never touch freed memory.
+            static Shared& shared()
+            {
+                static Shared& instance = *new Shared;
+                return instance;
+            }
+
+            static LocalList& localList()
+            {
+                thread_local LocalList list;
+                return list;
+            }
+        };
+    }
+
+    /**
+     * @brief The handle to the result of a task submitted with WorkStealingPool::submit. The result lives in a pooled
+     * slot, so submitting neither allocates a shared state like std::promise nor type erases like
+     * std::packaged_task. Destroying the handle without taking the result is fine, the slot is recycled when the task
+     * finishes.
+     *
+     * @tparam ReturnT The result type of the task, may be void.
+     * @tparam isNoexcept Whether the task is noexcept, then no exception is stored.
+     */
+    template <typename ReturnT, bool isNoexcept>
+    class TaskResult
+    {
+      private:
+        using Slot = Detail::ResultSlot<ReturnT, isNoexcept>;
+        using Arena = Detail::ResultSlotArena<Slot>;
+
+      public:
+        TaskResult() noexcept = default;
+
+        TaskResult(TaskResult&& other) noexcept
+            : pool_{other.pool_}
+            , slot_{std::exchange(other.slot_, nullptr)}
+        {}
+
+        TaskResult& operator=(TaskResult&& other) noexcept
+        {
+            if (this != &other)
+            {
+                abandon();
+                pool_ = other.pool_;
+                slot_ = std::exchange(other.slot_, nullptr);
+            }
+            return *this;
+        }
+
+        ~TaskResult()
+        {
+            abandon();
+        }
+
+        /**
+         * @brief Returns true until the result was taken with get.
+         */
+        bool valid() const noexcept
+        {
+            return slot_ != nullptr;
+        }
+
+        /**
+         * @brief Returns true if the task finished, the handle must be valid.
+         */
+        bool ready() const noexcept
+        {
+            return slot_->state.load(std::memory_order_acquire) == Slot::ready;
+        }
+
+        /**
+         * @brief Waits until the task finished, running other tasks of the pool meanwhile. The handle must be valid.
+         */
+        void wait() const;
+
+        /**
+         * @brief Waits for the task and returns its result or rethrows its exception. Afterwards the handle is no
+         * longer valid.
+         */
+        ReturnT get()
+        {
+            wait();
+            struct Release
+            {
+                Slot* slot;
+
+                ~Release()
+                {
+                    Arena::release(slot);
+                }
+            } release{std::exchange(slot_, nullptr)};
+
+            if constexpr (!isNoexcept)
+                if (release.slot->exception)
+                    std::rethrow_exception(release.slot->exception);
+            return release.slot->result.take();
+        }
+
+      private:
+        friend class WorkStealingPool;
+
+        TaskResult(WorkStealingPool* pool, Slot* slot) noexcept
+            : pool_{pool}
+            , slot_{slot}
+        {}
+
+        void abandon() noexcept
+        {
+            if (slot_ == nullptr)
+                return;
+            // Whoever comes last (the task or the handle) recycles the slot.
+            auto* slot = std::exchange(slot_, nullptr);
+            if (slot->state.exchange(Slot::abandoned, std::memory_order_acq_rel) == Slot::ready)
+                Arena::release(slot);
+        }
+
+      private:
+        WorkStealingPool* pool_ = nullptr;
+        Slot* slot_ = nullptr;
+    };
+
+    /**
+     * @brief A thread pool where every worker owns a task queue. Workers take tasks from the back of their own queue
+     * and steal from the front of the others when it runs empty. Tasks posted from a worker go to its own queue, tasks
+     * posted from outside are distributed round robin.
+     */
+    class WorkStealingPool
+    {
+      public:
+        /// The inline capacity of a Task in bytes.
+        constexpr static std::size_t taskCapacity = 6 * sizeof(void*);
+
+        /// Tasks are stored inline and must not throw.
+        using Task = InplaceFunction<void() noexcept, taskCapacity>;
+
+        /**
+         * @brief Starts the worker threads.
+         *
+         * @param threadCount The number of workers, at least one is started.
+         */
+        explicit WorkStealingPool(std::size_t threadCount = std::thread::hardware_concurrency())
+            : queueCount_{std::max<std::size_t>(threadCount, 1)}
+            , queues_{std::make_unique<Queue[]>(queueCount_)}
+        {
+            workers_.reserve(queueCount_);
+            for (std::size_t index = 0; index != queueCount_; ++index)
+                workers_.emplace_back([this, index] {
+                    workerLoop(index);
+                });
+        }
+
+        WorkStealingPool(WorkStealingPool const&) = delete;
+        WorkStealingPool& operator=(WorkStealingPool const&) = delete;
+
+        /**
+         * @brief Runs all queued tasks and joins the workers.
+         */
+        ~WorkStealingPool()
+        {
+            stopping_.store(true, std::memory_order_relaxed);
+            epoch_.fetch_add(1, std::memory_order_release);
+            epoch_.notify_all();
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        /**
+         * @brief The number of worker threads.
+         */
+        std::size_t size() const noexcept
+        {
+            return queueCount_;
+        }
+
+        /**
+         * @brief Queues a task for execution on one of the workers.
+         */
+        void post(Task task)
+        {
+            auto const index = currentPool_ == this ? currentIndex_
+                                                     : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queueCount_;
+            {
+                std::lock_guard lock{queues_[index].mutex};
+                queues_[index].tasks.push_back(std::move(task));
+            }
+            epoch_.fetch_add(1, std::memory_order_release);
+            epoch_.notify_one();
+        }
+
+        /**
+         * @brief Queues the function with the given arguments for execution and returns the handle to its result. The
+         * result type and whether an exception can occur come from FunctionTraitsFor, the function is invoked with the
+         * decayed arguments as rvalues. The function and the arguments are stored in the task, so together they must
+         * fit into taskCapacity minus a pointer.
+         *
+         * @return TaskResult The handle to the result, backed by a pooled slot.
+         */
+        template <typename FunctionT, typename... Args>
+        requires std::is_invocable_v<std::decay_t<FunctionT>&, std::decay_t<Args>...>
+        auto submit(FunctionT&& function, Args&&... args)
+        {
+            using Core = FunctionTraitsFor<std::decay_t<FunctionT>, std::decay_t<Args>...>;
+            using ReturnType = typename Core::ReturnType;
+            constexpr bool isNoexcept = Core::qualifiers.isNoexcept;
+            static_assert(
+                std::is_void_v<ReturnType> || std::is_object_v<ReturnType>,
+                "submit does not support functions returning references.");
+
+            using Slot = Detail::ResultSlot<ReturnType, isNoexcept>;
+            using Arena = Detail::ResultSlotArena<Slot>;
+            auto* slot = Arena::acquire();
+            try
+            {
+                auto task = [slot,
+                             function = std::forward<FunctionT>(function),
+                             ... arguments = std::forward<Args>(args)]() mutable noexcept {
+                    auto call = [&]() noexcept(isNoexcept) -> ReturnType {
+                        return std::invoke(function, std::move(arguments)...);
+                    };
+                    slot->run(call);
+                };
+                static_assert(
+                    sizeof(task) <= taskCapacity,
+                    "The function and its arguments do not fit into a task, pass large arguments by pointer.");
+                post(std::move(task));
+            }
+            catch (...)
+            {
+                Arena::release(slot);
+                throw;
+            }
+            return TaskResult<ReturnType, isNoexcept>{this, slot};
+        }
+
+        /**
+         * @brief Runs one queued task on the calling thread. Used by threads that wait for tasks of this pool, so that
+         * waiting from within a worker can not dead lock.
+         *
+         * @return true if a task was run, false if all queues were empty.
+         */
+        bool runPendingTask()
+        {
+            auto const start = currentPool_ == this ? currentIndex_ : 0;
+            Task task;
+            if (!tryTake(start, task))
+                return false;
+            task();
+            return true;
+        }
+
+        /**
+         * @brief The pool shared by all parallel algorithms of the library, with one worker per hardware thread.
+         */
+        static WorkStealingPool& defaultPool()
+        {
+            static WorkStealingPool pool;
+            return pool;
+        }
+
+      private:
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /// Takes a task from the back of the own queue or steals one from the front of another queue.
+        bool tryTake(std::size_t ownIndex, Task& task)
+        {
+            for (std::size_t offset = 0; offset != queueCount_; ++offset)
+            {
+                auto& queue = queues_[(ownIndex + offset) % queueCount_];
+                std::lock_guard lock{queue.mutex};
+                if (queue.tasks.empty())
+                    continue;
+
+                if (offset == 0)
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                return true;
+            }
+            return false;
+        }
+
+        void workerLoop(std::size_t index)
+        {
+            currentPool_ = this;
+            currentIndex_ = index;
+
+            Task task;
+            while (true)
+            {
+                // Read before looking for work: a task posted afterwards changes the epoch, so the wait below can not
+                // miss it.
+                auto const observed = epoch_.load(std::memory_order_acquire);
+                if (tryTake(index, task))
+                {
+                    task();
+                    task.reset();
+                    continue;
+                }
+                if (stopping_.load(std::memory_order_relaxed))
+                    return;
+                epoch_.wait(observed, std::memory_order_acquire);
+            }
+        }
+
+      private:
+        std::size_t queueCount_;
+        std::unique_ptr<Queue[]> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<std::size_t> nextQueue_{0};
+        /// Incremented for every posted task, idle workers sleep on it (futex based, no mutex).
+        std::atomic<std::uint32_t> epoch_{0};
+        std::atomic<bool> stopping_{false};
+
+        inline static thread_local WorkStealingPool const* currentPool_ = nullptr;
+        inline static thread_local std::size_t currentIndex_ = 0;
+    };
+
+    template <typename ReturnT, bool isNoexcept>
+    void TaskResult<ReturnT, isNoexcept>::wait() const
+    {
+        while (!ready())
+        {
+            if (pool_->runPendingTask())
+                continue;
+            slot_->state.wait(Slot::pending, std::memory_order_acquire);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace Traits
+{
+    namespace Detail
+    {
+        template <std::size_t N, typename T>
+        struct IndexedType
+        {
+            using type = T;
+        };
+
+        template <typename Indices, typename... Ts>
+        struct IndexedTypes;
+
+        template <std::size_t... Indices, typename... Ts>
+        struct IndexedTypes<std::index_sequence<Indices...>, Ts...> : public IndexedType<Indices, Ts>...
+        {};
+
+        /// Only declared, used to let overload resolution pick the base class with the matching index.
+        template <std::size_t N, typename T>
+        IndexedType<N, T> selectIndexedType(IndexedType<N, T> const*);
+
+        /**
+         * @brief Resolves the N-th type of a pack without recursion. This is the fallback for compilers that do not
+         * provide a pack indexing builtin: all types are inherited at once (flat), then the base with index N is
+         * selected through overload resolution.
+         *
+         * @tparam N The index of the type.
+         * @tparam Ts The pack.
+         */
+        template <std::size_t N, typename... Ts>
+        struct PackElementFlat
+        {
+            static_assert(N < sizeof...(Ts), "Pack index out of range");
+
+            using type = typename decltype(selectIndexedType<N>(
+                static_cast<IndexedTypes<std::index_sequence_for<Ts...>, Ts...> const*>(nullptr)))::type;
+        };
+    }
+
+    /**
+     * @brief The N-th type of the pack Ts. Uses pack indexing or the __type_pack_element builtin where available, which
+     * do not instantiate anything per lookup, and falls back to a flat (non recursive) implementation elsewhere.
+     *
+     * @tparam N The index of the type.
+     * @tparam Ts The pack.
+     */
+#if defined(__cpp_pack_indexing)
+    template <std::size_t N, typename... Ts>
+    using PackElement = Ts...[N];
+#elif defined(__has_builtin)
+#    if __has_builtin(__type_pack_element)
+    template <std::size_t N, typename... Ts>
+    using PackElement = __type_pack_element<N, Ts...>;
+#    else
+    template <std::size_t N, typename... Ts>
+    using PackElement = typename Detail::PackElementFlat<N, Ts...>::type;
+#    endif
+#else
+    template <std::size_t N, typename... Ts>
+    using PackElement = typename Detail::PackElementFlat<N, Ts...>::type;
+#endif
+
+    /**
+     * @brief A lightweight list of types. In contrast to std::tuple it is never instantiated for its members, so it is
+     * cheap to form even for large packs.
+     *
+     * @tparam Ts The types in the list.
+     */
+    template <typename... Ts>
+    struct TypeList
+    {
+        /// The number of types in the list.
+        constexpr static std::size_t size = sizeof...(Ts);
+
+        /// The N-th type of the list.
+        template <std::size_t N>
+        using At = PackElement<N, Ts...>;
+
+        /// Instantiates the given template with the types of the list, e.g. Apply<std::tuple>.
+        template <template <typename...> typename TemplateT>
+        using Apply = TemplateT<Ts...>;
+    };
+}
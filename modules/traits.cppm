@@ -0,0 +1,35 @@
+module;
+
+#include <traits/functions.hpp>
+
+export module nui.traits;
+
+// The module exports the function traits surface: traits/functions.hpp with the core, TypeList and the std::tuple and
+// std::function aliases. The utilities built on top of the traits (FunctionRef, thread pools, ...) stay headers.
+export namespace Traits
+{
+    using Traits::FunctionQualifiers;
+    using Traits::FunctionTraitsCommon;
+    using Traits::FunctionTraitsClassCommon;
+    using Traits::FunctionTraitsImpl;
+    using Traits::FunctionTraitsCore;
+    using Traits::FunctionTraits;
+    using Traits::FunctionTraitsFor;
+
+    using Traits::PackElement;
+    using Traits::TypeList;
+
+    using Traits::ArgsTupleOf;
+    using Traits::ArgsTupleDecayedOf;
+    using Traits::StandardFunctionOf;
+    using Traits::StandardFunctionDecayedOf;
+
+    namespace Detail
+    {
+        using Traits::Detail::IsFunctionObject;
+        using Traits::Detail::IsRegularFunction;
+        using Traits::Detail::IsMemberFunctionPointer;
+        using Traits::Detail::HasUniqueCallOperator;
+        using Traits::Detail::HasFunctionTraits;
+    }
+}
@@ -0,0 +1,29 @@
+// Built as its own translation unit: instrumentation is disabled here and enabled in main.cpp, both are linked into
+// the same test binary.
+#define TRAITS_LIB_ENABLE_INSTRUMENTATION 0
+
+#include <traits/instrument.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct InstrumentDisabledTests : public ::testing::Test
+    {};
+
+    TEST_F(InstrumentDisabledTests, CompilesToPlainCalls)
+    {
+        auto function = [](int lhs, int rhs) noexcept { return lhs + rhs; };
+        auto add = instrument(function, "InstrumentDisabledTests.add");
+        static_assert(std::is_same_v<decltype(add), InstrumentationDisabled::Instrumented<decltype(function)>>);
+        static_assert(sizeof(add) == sizeof(function));
+        static_assert(noexcept(add(1, 2)));
+        EXPECT_EQ(add(1, 2), 3);
+
+        // Nothing is registered.
+        for (auto const& snapshot : InstrumentationRegistry::global().snapshot())
+            EXPECT_NE(snapshot.name, "InstrumentDisabledTests.add");
+    }
+}
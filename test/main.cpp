@@ -1,4 +1,26 @@
+#include "test_batch_invoke.hpp"
+#include "test_buffer_invoke.hpp"
+#include "test_c_thunk.hpp"
+#include "test_call_recorder.hpp"
+#include "test_coalesce.hpp"
+#include "test_compose.hpp"
+#include "test_dataflow.hpp"
+#include "test_function_pointer.hpp"
+#include "test_function_ref.hpp"
 #include "test_function_traits.hpp"
+#include "test_functions_core.hpp"
+#include "test_inplace_function.hpp"
+#include "test_instrument.hpp"
+#include "test_map_simd.hpp"
+#include "test_memoize.hpp"
+#include "test_optimal_param.hpp"
+#include "test_parallel_batch_invoke.hpp"
+#include "test_registry.hpp"
+#include "test_signature_id.hpp"
+#include "test_task.hpp"
+#include "test_task_queue.hpp"
+#include "test_thread_pool.hpp"
+#include "test_type_list.hpp"
 #include "readme_example.hpp"
 
 #include <gtest/gtest.h>
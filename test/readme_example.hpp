@@ -48,6 +48,7 @@ TEST(ReadmeExample, ReadmeFunctionExampleIsCorrect)
         std::is_same_v<LambdaTraits::ArgumentDecayed<0>, std::string>, "Lambda should take size_t as argument");
     static_assert(std::is_same_v<LambdaTraits::ArgsTuple, std::tuple<std::string const&, std::size_t>>);
     static_assert(std::is_same_v<LambdaTraits::ArgsTupleDecayed, std::tuple<std::string, std::size_t>>);
+    static_assert(std::is_same_v<LambdaTraits::ArgsTypeList, TypeList<std::string const&, std::size_t>>);
     static_assert(LambdaTraits::qualifiers.isConst, "Lambda is not mutable");
     static_assert(!LambdaTraits::qualifiers.isVolatile, "Lambda is not volatile");
     static_assert(LambdaTraits::qualifiers.isNoexcept, "Lambda is noexcept");
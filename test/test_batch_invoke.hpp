@@ -0,0 +1,96 @@
+#pragma once
+
+#include <traits/batch_invoke.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Traits::Tests
+{
+    std::int64_t weightedSum(std::int32_t value, double const& weight)
+    {
+        return static_cast<std::int64_t>(value * weight);
+    }
+
+    struct BatchInvokeTests : public ::testing::Test
+    {};
+
+    TEST_F(BatchInvokeTests, InvokesOncePerRow)
+    {
+        std::vector<float> lhs(1001);
+        std::vector<float> rhs(1001);
+        std::iota(lhs.begin(), lhs.end(), 0.0f);
+        std::iota(rhs.begin(), rhs.end(), 1.0f);
+        std::vector<float> output(1001);
+
+        invokeBatch(
+            [](float x, float y) {
+                return x * y;
+            },
+            std::span{output},
+            std::span{lhs},
+            std::span<float const>{rhs});
+
+        for (std::size_t row = 0; row < output.size(); ++row)
+            EXPECT_FLOAT_EQ(output[row], lhs[row] * rhs[row]);
+    }
+
+    TEST_F(BatchInvokeTests, UnrolledVariantHandlesTails)
+    {
+        std::vector<std::int32_t> values(13);
+        std::vector<double> weights(13, 2.0);
+        std::iota(values.begin(), values.end(), 0);
+        std::vector<std::int64_t> output(13);
+
+        invokeBatchUnrolled<4>(weightedSum, std::span{output}, std::span{values}, std::span{weights});
+        for (std::size_t row = 0; row < output.size(); ++row)
+            EXPECT_EQ(output[row], static_cast<std::int64_t>(row) * 2);
+
+        std::vector<std::int64_t> single(13);
+        invokeBatchUnrolled<1>(&weightedSum, std::span{single}, std::span{values}, std::span{weights});
+        EXPECT_EQ(single, output);
+    }
+
+    TEST_F(BatchInvokeTests, StatefulFunctionsAreInvokedInOrder)
+    {
+        std::vector<int> input{1, 2, 3, 4, 5};
+        std::vector<int> output(5);
+        int runningTotal = 0;
+
+        invokeBatch(
+            [&runningTotal](int value) {
+                runningTotal += value;
+                return runningTotal;
+            },
+            std::span{output},
+            std::span{input});
+        EXPECT_EQ(output, (std::vector<int>{1, 3, 6, 10, 15}));
+    }
+
+    TEST_F(BatchInvokeTests, RejectsColumnsOfDifferentLength)
+    {
+        std::vector<int> input(3);
+        std::vector<int> output(4);
+        auto identity = [](int value) {
+            return value;
+        };
+        EXPECT_THROW(invokeBatch(identity, std::span{output}, std::span{input}), std::length_error);
+        EXPECT_THROW(invokeBatchUnrolled(identity, std::span{output}, std::span{input}), std::length_error);
+    }
+
+    TEST_F(BatchInvokeTests, DetectsOverlappingColumns)
+    {
+        std::vector<int> values(8);
+        std::vector<int> other(4);
+        auto const all = std::span{values};
+        EXPECT_TRUE(Detail::columnsOverlap(all, all));
+        EXPECT_TRUE(Detail::columnsOverlap(all.first(4), all.subspan(3, 4)));
+        EXPECT_FALSE(Detail::columnsOverlap(all.first(4), all.subspan(4)));
+        EXPECT_FALSE(Detail::columnsOverlap(all.first(4), std::span{other}));
+    }
+}
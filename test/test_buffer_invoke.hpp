@@ -0,0 +1,91 @@
+#pragma once
+
+#include <traits/argument_layout.hpp>
+#include <traits/buffer_invoke.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace Traits::Tests
+{
+    struct Vector3
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    double scaleAndOffset(std::uint8_t scale, double value, Vector3 const& offset) noexcept
+    {
+        return scale * value + offset.x + offset.y + offset.z;
+    }
+
+    struct BufferInvokeTests : public ::testing::Test
+    {};
+
+    TEST_F(BufferInvokeTests, LayoutIsComputedAtCompileTime)
+    {
+        using Layout = ArgumentLayoutOf<decltype(scaleAndOffset)>;
+        static_assert(Layout::arity == 3);
+        static_assert(Layout::isSupported);
+        static_assert(Layout::size<0> == 1 && Layout::offset<0> == 0);
+        static_assert(Layout::size<1> == sizeof(double) && Layout::offset<1> == alignof(double));
+        static_assert(Layout::size<2> == sizeof(Vector3) && Layout::alignment<2> == alignof(float));
+        static_assert(Layout::offset<2> == alignof(double) + sizeof(double));
+        static_assert(Layout::packedSize == alignof(double) + sizeof(double) + sizeof(Vector3));
+        static_assert(Layout::hasPadding);
+
+        static_assert(ArgumentLayoutOf<void()>::packedSize == 0);
+        static_assert(!ArgumentLayoutOf<void(int, short)>::hasPadding);
+        SUCCEED();
+    }
+
+    TEST_F(BufferInvokeTests, RejectsUnsupportedArguments)
+    {
+        EXPECT_FALSE(ArgumentLayoutOf<void(std::string)>::isSupported);
+        EXPECT_FALSE(ArgumentLayoutOf<void(int&)>::isSupported);
+        EXPECT_TRUE(ArgumentLayoutOf<void(int const&, int&&)>::isSupported);
+    }
+
+    TEST_F(BufferInvokeTests, PackedArgumentsRoundTrip)
+    {
+        std::array<std::byte, ArgumentLayoutOf<decltype(scaleAndOffset)>::packedSize> buffer;
+        buffer.fill(std::byte{0xff});
+
+        auto const written = packArgs<decltype(scaleAndOffset)>(buffer, 2, 1.5f, Vector3{.x = 1, .y = 2, .z = 3});
+        EXPECT_EQ(written, buffer.size());
+        EXPECT_EQ(buffer[1], std::byte{0});
+
+        EXPECT_DOUBLE_EQ(invokeFromBuffer(scaleAndOffset, buffer), 9.0);
+        EXPECT_DOUBLE_EQ(invokeFromBuffer(&scaleAndOffset, buffer), 9.0);
+    }
+
+    TEST_F(BufferInvokeTests, ReadsFromUnalignedBuffers)
+    {
+        auto lambda = [](std::int32_t lhs, std::int64_t rhs) {
+            return lhs + rhs;
+        };
+        alignas(std::int64_t) std::array<std::byte, 1 + ArgumentLayoutOf<decltype(lambda)>::packedSize> storage{};
+        auto unaligned = std::span<std::byte>{storage}.subspan(1);
+
+        packArgs<decltype(lambda)>(unaligned, 40, std::int64_t{2});
+        EXPECT_EQ(invokeFromBuffer(lambda, unaligned), 42);
+    }
+
+    TEST_F(BufferInvokeTests, ThrowsOnShortBuffers)
+    {
+        std::array<std::byte, 4> buffer{};
+        EXPECT_THROW(invokeFromBuffer(scaleAndOffset, buffer), std::length_error);
+        EXPECT_THROW(packArgs<decltype(scaleAndOffset)>(buffer, 1, 1.0, Vector3{}), std::length_error);
+
+        auto noArguments = []() {
+            return 7;
+        };
+        EXPECT_EQ(invokeFromBuffer(noArguments, {}), 7);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <traits/c_thunk.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    /// Mimics a C library that stores a callback together with a context pointer.
+    int callWithContext(int (*callback)(void*, int), void* context, int value)
+    {
+        return callback(context, value);
+    }
+
+    struct EventHandler
+    {
+        int total = 0;
+
+        int add(int value)
+        {
+            total += value;
+            return total;
+        }
+
+        int peek(int offset) const noexcept
+        {
+            return total + offset;
+        }
+
+        int peekVolatile(int offset) const volatile
+        {
+            return total + offset;
+        }
+
+        std::string consume(char character) &&
+        {
+            return std::string(static_cast<std::size_t>(total), character);
+        }
+
+        void reset() & noexcept
+        {
+            total = 0;
+        }
+    };
+
+    struct CThunkTests : public ::testing::Test
+    {};
+
+    TEST_F(CThunkTests, ThunkTypeHasContextParameter)
+    {
+        EXPECT_TRUE((std::is_same_v<CThunkOf<decltype(&EventHandler::add)>, int (*)(void*, int)>));
+        EXPECT_TRUE((std::is_same_v<CThunkOf<decltype(&EventHandler::peek)>, int (*)(void*, int) noexcept>));
+        EXPECT_TRUE((std::is_same_v<CThunkOf<decltype(&EventHandler::reset)>, void (*)(void*) noexcept>));
+        EXPECT_TRUE((std::is_same_v<decltype(makeCThunk<&EventHandler::peek>()), int (*)(void*, int) noexcept>));
+    }
+
+    TEST_F(CThunkTests, CallsMemberFunctionOnContext)
+    {
+        EventHandler handler;
+        EXPECT_EQ(callWithContext(makeCThunk<&EventHandler::add>(), &handler, 2), 2);
+        EXPECT_EQ(callWithContext(makeCThunk<&EventHandler::add>(), &handler, 3), 5);
+        EXPECT_EQ(handler.total, 5);
+
+        EXPECT_EQ(callWithContext(makeCThunk<&EventHandler::peek>(), &handler, 1), 6);
+        EXPECT_EQ(makeCThunk<&EventHandler::peekVolatile>()(&handler, 2), 7);
+    }
+
+    TEST_F(CThunkTests, HonoursReferenceQualifiers)
+    {
+        EventHandler handler{.total = 3};
+        EXPECT_EQ(makeCThunk<&EventHandler::consume>()(&handler, 'a'), "aaa");
+
+        makeCThunk<&EventHandler::reset>()(&handler);
+        EXPECT_EQ(handler.total, 0);
+    }
+
+    TEST_F(CThunkTests, IsUsableInConstantExpressions)
+    {
+        constexpr auto thunk = makeCThunk<&EventHandler::add>();
+        EXPECT_EQ(thunk, makeCThunk<&EventHandler::add>());
+    }
+}
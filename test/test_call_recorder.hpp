@@ -0,0 +1,104 @@
+#pragma once
+
+#include <traits/call_recorder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if TRAITS_LIB_HAS_CALL_RECORDER
+
+namespace Traits::Tests
+{
+    struct CallRecorderTests : public ::testing::Test
+    {
+        std::string path = (std::filesystem::temp_directory_path() /
+                            ("traits_call_log_" + std::to_string(::getpid()) + ".bin"))
+                               .string();
+
+        void TearDown() override
+        {
+            std::remove(path.c_str());
+        }
+    };
+
+    TEST_F(CallRecorderTests, RecordsAndReplaysCalls)
+    {
+        {
+            auto recorder = recordCalls([](int lhs, double const& rhs) { return lhs + rhs; }, path, 16);
+            EXPECT_EQ(recorder(1, 0.5), 1.5);
+            EXPECT_EQ(recorder(2, 0.25), 2.25);
+            EXPECT_TRUE(recorder.record(3, 0.0));
+            EXPECT_EQ(recorder.recorded(), 3u);
+        }
+        EXPECT_EQ(
+            std::filesystem::file_size(path),
+            sizeof(Detail::CallLogHeader) + 3 * ArgumentLayoutOf<void (*)(int, double)>::packedSize);
+
+        std::vector<double> replayed;
+        auto const result = replay([&](int lhs, double rhs) { replayed.push_back(lhs + rhs); }, path);
+        EXPECT_EQ(result.calls, 3u);
+        EXPECT_EQ(replayed, (std::vector<double>{1.5, 2.25, 3.0}));
+    }
+
+    TEST_F(CallRecorderTests, DropsCallsBeyondTheCapacity)
+    {
+        {
+            auto recorder = recordCalls([](int) noexcept {}, path, 2);
+            for (int value = 0; value != 5; ++value)
+                recorder(value);
+            EXPECT_EQ(recorder.recorded(), 2u);
+            EXPECT_EQ(recorder.dropped(), 3u);
+        }
+        std::vector<int> replayed;
+        replay([&](int value) { replayed.push_back(value); }, path);
+        EXPECT_EQ(replayed, (std::vector<int>{0, 1}));
+    }
+
+    TEST_F(CallRecorderTests, RecordsFromThreads)
+    {
+        constexpr int threadCount = 4;
+        constexpr int callsPerThread = 1000;
+        {
+            auto recorder = recordCalls([](int, int) noexcept {}, path, threadCount * callsPerThread);
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread != threadCount; ++thread)
+                threads.emplace_back([&recorder, thread] {
+                    for (int call = 0; call != callsPerThread; ++call)
+                        recorder(thread, call);
+                });
+            for (auto& thread : threads)
+                thread.join();
+        }
+
+        std::vector<int> calls(threadCount, 0);
+        long sum = 0;
+        auto const result = replay(
+            [&](int thread, int call) {
+                ++calls[static_cast<std::size_t>(thread)];
+                sum += call;
+            },
+            path);
+        EXPECT_EQ(result.calls, static_cast<std::size_t>(threadCount * callsPerThread));
+        EXPECT_EQ(calls, std::vector<int>(threadCount, callsPerThread));
+        EXPECT_EQ(sum, long{threadCount} * callsPerThread * (callsPerThread - 1) / 2);
+    }
+
+    TEST_F(CallRecorderTests, RejectsOtherLogs)
+    {
+        {
+            auto recorder = recordCalls([](int) noexcept {}, path, 1);
+            recorder(1);
+        }
+        EXPECT_THROW(replay([](double) {}, path), std::runtime_error);
+        EXPECT_THROW(replay([](int) {}, path + ".missing"), std::system_error);
+    }
+}
+
+#endif
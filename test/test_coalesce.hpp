@@ -0,0 +1,110 @@
+#pragma once
+
+#include <traits/coalesce.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct CoalesceTests : public ::testing::Test
+    {
+        /// Calls the coalesced function from several threads, the gate opens once all others wait for the first call.
+        template <typename CoalescedT, typename GateT, typename CallT>
+        static void callConcurrently(CoalescedT const& coalesced, GateT& gate, std::size_t threadCount, CallT call)
+        {
+            std::vector<std::thread> threads;
+            threads.emplace_back(call);
+            while (coalesced.inFlight() == 0)
+                std::this_thread::yield();
+            for (std::size_t index = 1; index != threadCount; ++index)
+                threads.emplace_back(call);
+            while (coalesced.waiting() != threadCount - 1)
+                std::this_thread::yield();
+
+            gate.store(true);
+            gate.notify_all();
+            for (auto& thread : threads)
+                thread.join();
+        }
+    };
+
+    TEST_F(CoalesceTests, ConcurrentCallsShareOneExecution)
+    {
+        std::atomic<bool> gate{false};
+        std::atomic<int> calls{0};
+        auto coalesced = coalesce([&](std::string const& key) {
+            ++calls;
+            gate.wait(false);
+            return key + "!";
+        });
+        EXPECT_TRUE((std::is_same_v<decltype(coalesced)::KeyType, std::tuple<std::string>>));
+
+        std::atomic<int> correct{0};
+        callConcurrently(coalesced, gate, 8, [&] { correct += coalesced(std::string_view{"key"}) == "key!"; });
+        EXPECT_EQ(calls.load(), 1);
+        EXPECT_EQ(correct.load(), 8);
+        EXPECT_EQ(coalesced.inFlight(), 0u);
+        EXPECT_EQ(coalesced.waiting(), 0u);
+
+        // Results are not cached.
+        EXPECT_EQ(coalesced("key"), "key!");
+        EXPECT_EQ(calls.load(), 2);
+    }
+
+    TEST_F(CoalesceTests, DifferentKeysExecuteSeparately)
+    {
+        std::atomic<int> calls{0};
+        auto coalesced = coalesce([&](int lhs, int rhs) noexcept {
+            ++calls;
+            return lhs + rhs;
+        });
+        EXPECT_TRUE(decltype(coalesced)::isNoexcept);
+
+        EXPECT_EQ(coalesced(1, 2), 3);
+        EXPECT_EQ(coalesced(2, 1), 3);
+        EXPECT_EQ(calls.load(), 2);
+    }
+
+    TEST_F(CoalesceTests, ExceptionsReachAllWaiters)
+    {
+        std::atomic<bool> gate{false};
+        auto coalesced = coalesce([&](int value) -> int {
+            gate.wait(false);
+            throw std::runtime_error{std::to_string(value)};
+        });
+        EXPECT_FALSE(decltype(coalesced)::isNoexcept);
+
+        std::atomic<int> thrown{0};
+        callConcurrently(coalesced, gate, 4, [&] {
+            try
+            {
+                coalesced(7);
+            }
+            catch (std::runtime_error const& error)
+            {
+                thrown += std::string{error.what()} == "7";
+            }
+        });
+        EXPECT_EQ(thrown.load(), 4);
+    }
+
+    TEST_F(CoalesceTests, VoidFunctions)
+    {
+        std::atomic<bool> gate{false};
+        std::atomic<int> calls{0};
+        auto coalesced = coalesce([&](int) noexcept {
+            ++calls;
+            gate.wait(false);
+        });
+
+        callConcurrently(coalesced, gate, 4, [&] { coalesced(1); });
+        EXPECT_EQ(calls.load(), 1);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <traits/compose.hpp>
+#include <traits/functions.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct ComposeTests : public ::testing::Test
+    {};
+
+    namespace
+    {
+        int parse(std::string const& text) noexcept
+        {
+            return std::stoi(text);
+        }
+    }
+
+    TEST_F(ComposeTests, CallsStagesInOrder)
+    {
+        auto pipeline = compose(&parse, [](int value) noexcept { return value * 2; }, [](long value) noexcept {
+            return std::to_string(value) + "!";
+        });
+        EXPECT_EQ(pipeline("21"), "42!");
+
+        constexpr auto increment = [](int value) { return value + 1; };
+        constexpr auto twice = [](int value) { return value * 2; };
+        static_assert(compose(increment, twice)(1) == 4);
+        static_assert((compose(increment) | twice | increment)(1) == 5);
+        static_assert((compose(twice) | compose(increment, increment))(1) == 4);
+    }
+
+    TEST_F(ComposeTests, TraitsOfTheComposition)
+    {
+        auto noexceptPipeline = compose(&parse, [](int value) noexcept { return value * 0.5; });
+        using NoexceptTraits = FunctionTraits<decltype(noexceptPipeline)>;
+        EXPECT_EQ(NoexceptTraits::arity, 1u);
+        EXPECT_TRUE((std::is_same_v<NoexceptTraits::Argument<0>, std::string const&>));
+        EXPECT_TRUE((std::is_same_v<NoexceptTraits::ReturnType, double>));
+        EXPECT_TRUE(NoexceptTraits::qualifiers.isNoexcept);
+        EXPECT_TRUE(NoexceptTraits::qualifiers.isConst);
+
+        auto throwingPipeline = noexceptPipeline | [](double value) { return std::to_string(value); };
+        EXPECT_FALSE(FunctionTraits<decltype(throwingPipeline)>::qualifiers.isNoexcept);
+
+        int calls = 0;
+        auto mutablePipeline = compose([calls](int value) mutable noexcept { return value + ++calls; });
+        EXPECT_FALSE(FunctionTraits<decltype(mutablePipeline)>::qualifiers.isConst);
+        EXPECT_EQ(mutablePipeline(1), 2);
+        EXPECT_EQ(mutablePipeline(1), 3);
+
+        auto binary = compose([](int lhs, int rhs) { return lhs + rhs; }, [](auto sum) { return sum * 2; });
+        EXPECT_EQ(FunctionTraits<decltype(binary)>::arity, 2u);
+        EXPECT_EQ(binary(1, 2), 6);
+    }
+
+    TEST_F(ComposeTests, MovesIntermediates)
+    {
+        auto pipeline = compose(
+            [](int size) { return std::vector<int>(static_cast<std::size_t>(size), 1); },
+            [](std::vector<int> values) {
+                values.push_back(2);
+                return values;
+            },
+            [](std::vector<int>&& values) { return values.size(); });
+        EXPECT_EQ(pipeline(3), 4u);
+
+        auto owning = compose(
+            [](int value) { return std::make_unique<int>(value); },
+            [](std::unique_ptr<int> pointer) { return *pointer + 1; });
+        EXPECT_EQ(owning(41), 42);
+
+        auto stateless = compose([](int value) noexcept { return value; }, [](int value) noexcept { return value; });
+        EXPECT_EQ(sizeof(stateless), 1u);
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <traits/dataflow.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <latch>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct DataflowTests : public ::testing::Test
+    {
+        struct Request
+        {
+            int userId;
+        };
+
+        struct User
+        {
+            std::string name;
+        };
+
+        struct Orders
+        {
+            int count;
+        };
+
+        struct Summary
+        {
+            std::string text;
+        };
+    };
+
+    TEST_F(DataflowTests, PassesResultsAlongTheDependencies)
+    {
+        auto flow = dataflow(
+            [](User const& user, Orders orders) { return Summary{user.name + ":" + std::to_string(orders.count)}; },
+            [](Request const& request) { return User{"user" + std::to_string(request.userId)}; },
+            [](Request const& request) noexcept { return Orders{request.userId * 2}; });
+
+        static_assert(std::is_same_v<decltype(flow)::ResultsType, std::tuple<Summary, User, Orders>>);
+
+        WorkStealingPool pool{2};
+        auto results = flow.run(pool, Request{21});
+        EXPECT_EQ(std::get<Summary>(results).text, "user21:42");
+        EXPECT_EQ(std::get<Orders>(results).count, 42);
+        EXPECT_EQ(std::get<0>(flow(Request{1})).text, "user1:2");
+    }
+
+    TEST_F(DataflowTests, CompileTimeGraph)
+    {
+        auto first = [](int value) noexcept { return static_cast<long>(value); };
+        auto second = [](long value) noexcept { return static_cast<double>(value); };
+        auto third = [](long lhs, double rhs) noexcept { return lhs + rhs > 0; };
+        using Graph = Detail::DataflowGraph<TypeList<int>, decltype(third), decltype(first), decltype(second)>;
+
+        static_assert(Graph::isAcyclic);
+        static_assert(Graph::dependencyCounts == std::array<std::size_t, 3>{2, 0, 1});
+        static_assert(Graph::dependencies[0][1] && Graph::dependencies[0][2] && Graph::dependencies[2][1]);
+        static_assert(Graph::producer<1, 0> == 3); // the input
+
+        auto cycleFirst = [](long value) noexcept { return static_cast<double>(value); };
+        auto cycleSecond = [](double value) noexcept { return static_cast<long>(value); };
+        static_assert(!Detail::DataflowGraph<TypeList<>, decltype(cycleFirst), decltype(cycleSecond)>::isAcyclic);
+    }
+
+    TEST_F(DataflowTests, RunsIndependentStagesConcurrently)
+    {
+        // Each load only returns once the other one is running as well.
+        std::latch bothRunning{2};
+        auto slow = [&] { bothRunning.arrive_and_wait(); };
+
+        auto flow = dataflow(
+            [&](Request const&) {
+                slow();
+                return User{"user"};
+            },
+            [&](Request const&) {
+                slow();
+                return Orders{1};
+            },
+            [](User const& user, Orders const& orders) {
+                return Summary{user.name + std::to_string(orders.count)};
+            });
+
+        WorkStealingPool pool{2};
+        EXPECT_EQ(std::get<Summary>(flow.run(pool, Request{})).text, "user1");
+        EXPECT_TRUE(bothRunning.try_wait());
+    }
+
+    TEST_F(DataflowTests, PropagatesExceptionsAndSkipsDependents)
+    {
+        std::atomic<int> dependentCalls{0};
+        std::atomic<int> independentCalls{0};
+        auto flow = dataflow(
+            [](Request const& request) -> User {
+                throw std::runtime_error{"lookup " + std::to_string(request.userId)};
+            },
+            [&](User const&) {
+                ++dependentCalls;
+                return Summary{};
+            },
+            [&](Summary const&) { ++dependentCalls; },
+            [&](Request const&) noexcept { ++independentCalls; });
+
+        WorkStealingPool pool{2};
+        EXPECT_THROW(flow.run(pool, Request{7}), std::runtime_error);
+        EXPECT_EQ(dependentCalls.load(), 0);
+        EXPECT_EQ(independentCalls.load(), 1);
+        static_assert(std::is_same_v<std::tuple_element_t<3, decltype(flow)::ResultsType>, NoResult>);
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <traits/function_pointer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    int negate(int value) noexcept
+    {
+        return -value;
+    }
+
+    struct StatelessAdder
+    {
+        int operator()(int lhs, int rhs) const noexcept
+        {
+            return lhs + rhs;
+        }
+    };
+
+    struct StatelessRvalueCallable
+    {
+        std::string operator()(char character) &&
+        {
+            return std::string(2, character);
+        }
+    };
+
+    struct FunctionPointerTests : public ::testing::Test
+    {};
+
+    TEST_F(FunctionPointerTests, DetectsStatelessCallables)
+    {
+        int state = 0;
+        auto captureless = [](int) {};
+        auto capturing = [state](int) {
+            return state;
+        };
+
+        EXPECT_TRUE(IsStateless<decltype(captureless)>);
+        EXPECT_TRUE(IsStateless<StatelessAdder>);
+        EXPECT_FALSE(IsStateless<decltype(capturing)>);
+        EXPECT_FALSE(IsStateless<int (*)(int)>);
+    }
+
+    TEST_F(FunctionPointerTests, FunctionPointerOfKeepsNoexcept)
+    {
+        auto lambda = [](std::string const&) noexcept {
+            return 0;
+        };
+        EXPECT_TRUE((std::is_same_v<FunctionPointerOf<decltype(lambda)>, int (*)(std::string const&) noexcept>));
+        EXPECT_TRUE((std::is_same_v<FunctionPointerOf<StatelessAdder>, int (*)(int, int) noexcept>));
+        EXPECT_TRUE((std::is_same_v<FunctionPointerOf<double(float)>, double (*)(float)>));
+    }
+
+    TEST_F(FunctionPointerTests, ConvertsCapturelessLambdas)
+    {
+        auto lambda = [](int value) noexcept {
+            return value * 4;
+        };
+        auto pointer = toFunctionPointer(lambda);
+        EXPECT_TRUE((std::is_same_v<decltype(pointer), int (*)(int) noexcept>));
+        EXPECT_EQ(pointer(2), 8);
+
+        auto mutableLambda = [](int value) mutable {
+            return value + 1;
+        };
+        EXPECT_EQ(toFunctionPointer(mutableLambda)(1), 2);
+    }
+
+    TEST_F(FunctionPointerTests, ConvertsStatelessFunctionObjects)
+    {
+        auto adder = toFunctionPointer(StatelessAdder{});
+        EXPECT_TRUE((std::is_same_v<decltype(adder), int (*)(int, int) noexcept>));
+        EXPECT_EQ(adder(1, 2), 3);
+
+        auto rvalueCallable = toFunctionPointer(StatelessRvalueCallable{});
+        EXPECT_EQ(rvalueCallable('x'), "xx");
+    }
+
+    TEST_F(FunctionPointerTests, FunctionsAreReturnedAsIs)
+    {
+        EXPECT_EQ(toFunctionPointer(negate), &negate);
+        EXPECT_EQ(toFunctionPointer(&negate), &negate);
+        static_assert(toFunctionPointer(negate) == &negate);
+    }
+
+    TEST_F(FunctionPointerTests, RejectsStatefulCallables)
+    {
+        int state = 0;
+        auto capturing = [state](int) {
+            return state;
+        };
+        EXPECT_FALSE(Detail::IsConvertibleToFunctionPointer<decltype(capturing)>);
+        EXPECT_FALSE(Detail::IsConvertibleToFunctionPointer<int (StatelessAdder::*)(int, int) const noexcept>);
+        EXPECT_TRUE(Detail::IsConvertibleToFunctionPointer<decltype(negate)>);
+    }
+}
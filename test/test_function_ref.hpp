@@ -0,0 +1,115 @@
+#pragma once
+
+#include <traits/function_ref.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    int twice(int value)
+    {
+        return value * 2;
+    }
+
+    int twiceNoexcept(int value) noexcept
+    {
+        return value * 2;
+    }
+
+    int callWith21(FunctionRef<int(int)> function)
+    {
+        return function(21);
+    }
+
+    struct FunctionRefTests : public ::testing::Test
+    {};
+
+    TEST_F(FunctionRefTests, IsTwoPointersWideAndTriviallyCopyable)
+    {
+        EXPECT_EQ(sizeof(FunctionRef<int(int)>), 2 * sizeof(void*));
+        EXPECT_EQ(sizeof(FunctionRef<void(std::string const&) const noexcept>), 2 * sizeof(void*));
+        EXPECT_TRUE(std::is_trivially_copyable_v<FunctionRef<int(int)>>);
+        EXPECT_TRUE(std::is_trivially_copyable_v<FunctionRef<int(int) const noexcept>>);
+    }
+
+    TEST_F(FunctionRefTests, CanCallFunctionsAndFunctionPointers)
+    {
+        EXPECT_EQ(callWith21(twice), 42);
+        EXPECT_EQ(callWith21(&twice), 42);
+        EXPECT_EQ(callWith21(&twiceNoexcept), 42);
+
+        FunctionRef deduced = &twiceNoexcept;
+        EXPECT_TRUE((std::is_same_v<decltype(deduced), FunctionRef<int(int) noexcept>>));
+        EXPECT_EQ(deduced(1), 2);
+    }
+
+    TEST_F(FunctionRefTests, ReferencesStatefulCallable)
+    {
+        int calls = 0;
+        auto counter = [&calls](int value) mutable {
+            ++calls;
+            return value + calls;
+        };
+        FunctionRef<int(int)> ref = counter;
+        EXPECT_EQ(ref(10), 11);
+        EXPECT_EQ(ref(10), 12);
+        EXPECT_EQ(calls, 2);
+
+        auto copy = ref;
+        EXPECT_EQ(copy(10), 13);
+    }
+
+    TEST_F(FunctionRefTests, ConvertsArgumentsAndReturnValue)
+    {
+        auto concat = [](std::string const& lhs, std::string const& rhs) {
+            return lhs + rhs;
+        };
+        FunctionRef<std::string(std::string, char const*) const> ref = concat;
+        EXPECT_EQ(ref("a", "b"), "ab");
+
+        FunctionRef<void(int)> discard = twice;
+        discard(1);
+    }
+
+    TEST_F(FunctionRefTests, ConstAndNoexceptAreEnforced)
+    {
+        int state = 0;
+        auto mutableLambda = [state](int) mutable {
+            ++state;
+        };
+        auto constLambda = [](int) {};
+        auto noexceptLambda = [](int) noexcept {};
+
+        EXPECT_TRUE((std::is_constructible_v<FunctionRef<void(int)>, decltype(mutableLambda)&>));
+        EXPECT_FALSE((std::is_constructible_v<FunctionRef<void(int) const>, decltype(mutableLambda)&>));
+        EXPECT_TRUE((std::is_constructible_v<FunctionRef<void(int) const>, decltype(constLambda)&>));
+        EXPECT_FALSE((std::is_constructible_v<FunctionRef<void(int) noexcept>, decltype(constLambda)&>));
+        EXPECT_TRUE((std::is_constructible_v<FunctionRef<void(int) const noexcept>, decltype(noexceptLambda)&>));
+        EXPECT_TRUE(noexcept(std::declval<FunctionRef<void(int) noexcept>>()(1)));
+        EXPECT_FALSE(noexcept(std::declval<FunctionRef<void(int)>>()(1)));
+
+        // Member function pointers can not be called with the plain call syntax, so they are rejected up front.
+        EXPECT_FALSE((std::is_constructible_v<FunctionRef<std::size_t(std::string const&)>,
+                                              decltype(&std::string::size)>));
+    }
+
+    TEST_F(FunctionRefTests, FunctionRefOfKeepsQualifiers)
+    {
+        auto lambda = [](std::string const&, int) noexcept {
+            return 0;
+        };
+        auto mutableLambda = [](double) mutable {};
+
+        EXPECT_TRUE((std::is_same_v<
+                     FunctionRefOf<decltype(lambda)>,
+                     FunctionRef<int(std::string const&, int) const noexcept>>));
+        EXPECT_TRUE((std::is_same_v<FunctionRefOf<decltype(mutableLambda)>, FunctionRef<void(double)>>));
+        EXPECT_TRUE((std::is_same_v<FunctionRefOf<int (*)(int)>, FunctionRef<int(int)>>));
+
+        FunctionRefOf<decltype(lambda)> ref = lambda;
+        EXPECT_EQ(ref("", 1), 0);
+    }
+}
@@ -494,6 +494,19 @@ namespace Traits::Tests
         EXPECT_TRUE((std::is_same_v<Traits::template ArgumentDecayed<1>, double>));
     }
 
+    struct Incomplete;
+
+    TEST_F(TraitsTests, CanInspectFunctionsTakingIncompleteTypes)
+    {
+        using Traits = FunctionTraits<void (*)(Incomplete&, Incomplete const*)>;
+        EXPECT_EQ(Traits::arity, 2);
+        EXPECT_TRUE((std::is_same_v<Traits::template Argument<0>, Incomplete&>));
+        EXPECT_TRUE((std::is_same_v<Traits::template ArgumentDecayed<1>, Incomplete const*>));
+        EXPECT_TRUE(
+            (std::is_same_v<Traits::StandardFunctionType, std::function<void(Incomplete&, Incomplete const*)>>));
+        EXPECT_TRUE((std::is_same_v<FunctionTraits<Incomplete& (*)()>::ReturnType, Incomplete&>));
+    }
+
     TEST_F(TraitsTests, CanInspectMutableLambdaFunction)
     {
         auto lambda = [](std::string const& a, double b) mutable -> std::string {
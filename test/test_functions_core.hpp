@@ -0,0 +1,83 @@
+#pragma once
+
+#include <traits/functions_core.hpp>
+#include <traits/functions_std_function.hpp>
+#include <traits/functions_tuple.hpp>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct FunctionsCoreTests : public ::testing::Test
+    {
+        int memberFunction(std::string const&, double) const& noexcept
+        {
+            return 0;
+        }
+    };
+
+    TEST_F(FunctionsCoreTests, CoreTraitsOfLambda)
+    {
+        auto lambda = [](std::string const&, int) mutable {
+            return 0.f;
+        };
+        using Traits = FunctionTraitsCore<decltype(lambda)>;
+        EXPECT_EQ(Traits::arity, 2);
+        EXPECT_TRUE((std::is_same_v<Traits::ReturnType, float>));
+        EXPECT_TRUE((std::is_same_v<Traits::Argument<0>, std::string const&>));
+        EXPECT_EQ(Traits::qualifiers, FunctionQualifiers{});
+    }
+
+    TEST_F(FunctionsCoreTests, SignatureDropsQualifiers)
+    {
+        using Traits = FunctionTraitsCore<decltype(&FunctionsCoreTests::memberFunction)>;
+        EXPECT_TRUE((std::is_same_v<Traits::Signature, int(std::string const&, double)>));
+        EXPECT_TRUE((std::is_same_v<Traits::SignatureDecayed, int(std::string, double)>));
+        EXPECT_TRUE((std::is_same_v<Traits::ClassType, FunctionsCoreTests>));
+    }
+
+    TEST_F(FunctionsCoreTests, ExtensionAliases)
+    {
+        using FunctionT = void (*)(int&, std::string const&);
+        EXPECT_TRUE((std::is_same_v<ArgsTupleOf<FunctionT>, std::tuple<int&, std::string const&>>));
+        EXPECT_TRUE((std::is_same_v<ArgsTupleDecayedOf<FunctionT>, std::tuple<int, std::string>>));
+        EXPECT_TRUE((std::is_same_v<StandardFunctionOf<FunctionT>, std::function<void(int&, std::string const&)>>));
+        EXPECT_TRUE((std::is_same_v<StandardFunctionDecayedOf<FunctionT>, std::function<void(int, std::string)>>));
+    }
+
+    TEST_F(FunctionsCoreTests, HasFunctionTraits)
+    {
+        EXPECT_TRUE((Detail::HasFunctionTraits<void()>));
+        EXPECT_TRUE((Detail::HasFunctionTraits<void (*)() noexcept>));
+        EXPECT_TRUE((Detail::HasFunctionTraits<decltype(&FunctionsCoreTests::memberFunction)>));
+    }
+
+    TEST_F(FunctionsCoreTests, FunctionTraitsForGenericLambdas)
+    {
+        auto generic = [](auto lhs, auto rhs) noexcept {
+            return lhs * rhs;
+        };
+        EXPECT_FALSE((Detail::HasFunctionTraits<decltype(generic)>));
+
+        using Traits = FunctionTraitsFor<decltype(generic), float, double>;
+        EXPECT_EQ(Traits::arity, 2);
+        EXPECT_TRUE((std::is_same_v<Traits::ReturnType, double>));
+        EXPECT_TRUE((std::is_same_v<Traits::Argument<0>, float>));
+        EXPECT_TRUE((std::is_same_v<Traits::Signature, double(float, double)>));
+        EXPECT_TRUE(Traits::qualifiers.isConst);
+        EXPECT_TRUE(Traits::qualifiers.isNoexcept);
+
+        auto mutableGeneric = [count = 0](auto const& value) mutable {
+            return value.size() + ++count;
+        };
+        using MutableTraits = FunctionTraitsFor<decltype(mutableGeneric), std::string const&>;
+        EXPECT_TRUE((std::is_same_v<MutableTraits::ReturnType, std::size_t>));
+        EXPECT_FALSE(MutableTraits::qualifiers.isConst);
+        EXPECT_FALSE(MutableTraits::qualifiers.isNoexcept);
+    }
+}
\ No newline at end of file
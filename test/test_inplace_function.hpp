@@ -0,0 +1,151 @@
+#pragma once
+
+#include <traits/inplace_function.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Traits::Tests
+{
+    int triple(int value)
+    {
+        return value * 3;
+    }
+
+    struct InplaceFunctionTests : public ::testing::Test
+    {};
+
+    TEST_F(InplaceFunctionTests, IsEmptyByDefault)
+    {
+        InplaceFunction<int(int)> function;
+        EXPECT_FALSE(static_cast<bool>(function));
+
+        function = &triple;
+        EXPECT_TRUE(static_cast<bool>(function));
+        EXPECT_EQ(function(2), 6);
+
+        function.reset();
+        EXPECT_FALSE(static_cast<bool>(function));
+    }
+
+    TEST_F(InplaceFunctionTests, NullPointersAreEmpty)
+    {
+        int (*nullFunction)(int) = nullptr;
+        InplaceFunction<int(int)> function{nullFunction};
+        EXPECT_FALSE(static_cast<bool>(function));
+
+        struct Counter
+        {
+            int value = 0;
+
+            int add(int amount)
+            {
+                return value += amount;
+            }
+        };
+        int (Counter::*nullMember)(int) = nullptr;
+        InplaceFunction<int(Counter&, int)> member{nullMember};
+        EXPECT_FALSE(static_cast<bool>(member));
+
+        member = &Counter::add;
+        Counter counter;
+        EXPECT_EQ(member(counter, 2), 2);
+        EXPECT_EQ(counter.value, 2);
+    }
+
+    TEST_F(InplaceFunctionTests, OwnsStatefulCallable)
+    {
+        InplaceFunction<int(int)> counter = [calls = 0](int value) mutable {
+            ++calls;
+            return value + calls;
+        };
+        EXPECT_EQ(counter(10), 11);
+        EXPECT_EQ(counter(10), 12);
+    }
+
+    TEST_F(InplaceFunctionTests, MovesAndDestroysTheCallable)
+    {
+        auto alive = std::make_shared<int>(5);
+        std::weak_ptr<int> observer = alive;
+        {
+            InplaceFunction<int() const> first = [value = std::move(alive)]() {
+                return *value;
+            };
+            EXPECT_EQ(first(), 5);
+
+            InplaceFunction<int() const> second = std::move(first);
+            EXPECT_FALSE(static_cast<bool>(first));
+            EXPECT_TRUE(static_cast<bool>(second));
+            EXPECT_EQ(second(), 5);
+            EXPECT_FALSE(observer.expired());
+
+            first = std::move(second);
+            EXPECT_EQ(first(), 5);
+        }
+        EXPECT_TRUE(observer.expired());
+    }
+
+    TEST_F(InplaceFunctionTests, SupportsMoveOnlyCallables)
+    {
+        auto pointer = std::make_unique<std::string>("inplace");
+        InplaceFunction<std::size_t()> function = [pointer = std::move(pointer)]() {
+            return pointer->size();
+        };
+        EXPECT_EQ(function(), 7u);
+        EXPECT_FALSE(std::is_copy_constructible_v<InplaceFunction<std::size_t()>>);
+        EXPECT_TRUE(std::is_nothrow_move_constructible_v<InplaceFunction<std::size_t()>>);
+    }
+
+    TEST_F(InplaceFunctionTests, CapacityAndAlignmentAreConfigurable)
+    {
+        EXPECT_GE(sizeof(InplaceFunction<void()>), defaultInplaceFunctionCapacity + 2 * sizeof(void*));
+        EXPECT_GE(sizeof(InplaceFunction<void(), 64>), 64u);
+        EXPECT_EQ(alignof(InplaceFunction<void(), 16, 8>), alignof(void*));
+
+        char buffer[48] = {};
+        buffer[47] = 'x';
+        InplaceFunction<char() const, sizeof(buffer)> large = [buffer]() {
+            return buffer[47];
+        };
+        EXPECT_EQ(large(), 'x');
+    }
+
+    TEST_F(InplaceFunctionTests, ConstAndNoexceptAreEnforced)
+    {
+        auto mutableLambda = [state = 0](int) mutable {
+            ++state;
+        };
+        auto constLambda = [](int) {};
+        auto noexceptLambda = [](int) noexcept {};
+
+        EXPECT_TRUE((std::is_constructible_v<InplaceFunction<void(int)>, decltype(mutableLambda)>));
+        EXPECT_FALSE((std::is_constructible_v<InplaceFunction<void(int) const>, decltype(mutableLambda)>));
+        EXPECT_TRUE((std::is_constructible_v<InplaceFunction<void(int) const>, decltype(constLambda)>));
+        EXPECT_FALSE((std::is_constructible_v<InplaceFunction<void(int) noexcept>, decltype(constLambda)>));
+        EXPECT_TRUE((std::is_constructible_v<InplaceFunction<void(int) const noexcept>, decltype(noexceptLambda)>));
+        EXPECT_TRUE(noexcept(std::declval<InplaceFunction<void(int) noexcept>&>()(1)));
+        EXPECT_FALSE(noexcept(std::declval<InplaceFunction<void(int)>&>()(1)));
+    }
+
+    TEST_F(InplaceFunctionTests, InplaceFunctionOfKeepsQualifiers)
+    {
+        auto lambda = [](std::string const&, int) noexcept {
+            return 0;
+        };
+
+        EXPECT_TRUE((std::is_same_v<
+                     InplaceFunctionOf<decltype(lambda)>,
+                     InplaceFunction<int(std::string const&, int) const noexcept>>));
+        EXPECT_TRUE((std::is_same_v<
+                     InplaceFunctionOf<int (*)(int), 16, 8>,
+                     InplaceFunction<int(int), 16, 8>>));
+        EXPECT_TRUE((std::is_same_v<InplaceFunctionOf<void (*)(double)>, InplaceFunction<void(double)>>));
+
+        InplaceFunctionOf<decltype(lambda)> function = lambda;
+        EXPECT_EQ(function("", 1), 0);
+    }
+}
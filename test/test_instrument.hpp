@@ -0,0 +1,95 @@
+#pragma once
+
+#include <traits/instrument.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct InstrumentTests : public ::testing::Test
+    {
+        static CallStatsSnapshot snapshotOf(std::string const& name)
+        {
+            for (auto& snapshot : InstrumentationRegistry::global().snapshot())
+                if (snapshot.name == name)
+                    return snapshot;
+            return {};
+        }
+    };
+
+    TEST_F(InstrumentTests, HistogramBuckets)
+    {
+        using Histogram = LatencyHistogram;
+        for (std::uint64_t value : {0ull, 7ull, 8ull, 15ull, 16ull, 1000ull, 123456789ull, ~0ull})
+        {
+            auto const index = Histogram::bucketIndex(value);
+            ASSERT_LT(index, Histogram::bucketCount);
+            EXPECT_LE(Histogram::bucketLowerBound(index), value);
+            if (index + 1 != Histogram::bucketCount)
+            {
+                EXPECT_GT(Histogram::bucketLowerBound(index + 1), value);
+            }
+        }
+        static_assert(Histogram::bucketIndex(8) == 8 && Histogram::bucketIndex(16) == 16);
+
+        Histogram histogram;
+        for (std::uint64_t value = 1; value <= 100; ++value)
+            ++histogram.buckets[Histogram::bucketIndex(value)];
+        EXPECT_EQ(histogram.count(), 100u);
+        EXPECT_NEAR(static_cast<double>(histogram.percentile(0.5)), 50.0, 50.0 / Histogram::subBucketCount);
+        EXPECT_EQ(histogram.percentile(1.0), 103u);
+    }
+
+    TEST_F(InstrumentTests, RecordsCallsPerNameAndSignature)
+    {
+        auto const function = [](int lhs, double rhs) noexcept { return lhs + rhs; };
+        auto add = instrument(function, "InstrumentTests.add");
+        EXPECT_EQ(add(1, 2.5), 3.5);
+        EXPECT_EQ(add(2, 0.5), 2.5);
+        EXPECT_EQ(add.stats().name(), "InstrumentTests.add");
+        using FunctionType = std::remove_const_t<decltype(function)>;
+        static_assert(std::is_same_v<decltype(add), InstrumentationEnabled::Instrumented<FunctionType>>);
+
+        // Equal name and signature share the statistics.
+        auto other = instrument([](int, double) noexcept { return 0.0; }, "InstrumentTests.add");
+        other(0, 0.0);
+
+        auto snapshot = snapshotOf("InstrumentTests.add");
+        EXPECT_EQ(snapshot.calls, 3u);
+        EXPECT_EQ(snapshot.signatureId, signatureIdOf<decltype(function)>);
+        EXPECT_EQ(snapshot.argumentBytes, (std::vector<std::size_t>{sizeof(int), sizeof(double)}));
+        EXPECT_NE(InstrumentationRegistry::global().report().find("InstrumentTests.add 3 "), std::string::npos);
+    }
+
+    TEST_F(InstrumentTests, RecordsThrowingCallsFromThreads)
+    {
+        auto check = instrument(
+            [](int value) {
+                if (value < 0)
+                    throw std::invalid_argument{"negative"};
+                return value;
+            },
+            "InstrumentTests.check");
+        EXPECT_THROW(check(-1), std::invalid_argument);
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread != 4; ++thread)
+            threads.emplace_back([&check] {
+                for (int call = 0; call != 1000; ++call)
+                    check(call);
+            });
+        for (auto& thread : threads)
+            thread.join();
+        EXPECT_EQ(snapshotOf("InstrumentTests.check").calls, 4001u);
+
+        check.stats().reset();
+        EXPECT_EQ(snapshotOf("InstrumentTests.check").calls, 0u);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <traits/map_simd.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct MapSimdTests : public ::testing::Test
+    {};
+
+    TEST_F(MapSimdTests, GenericLambdasUseSimdPacks)
+    {
+        auto multiplyAdd = [](auto lhs, auto rhs) {
+            return lhs * rhs + 1.0f;
+        };
+#if TRAITS_LIB_HAS_SIMD
+        EXPECT_TRUE((Detail::IsSimdInvocable<decltype(multiplyAdd), float, float, float const>));
+#endif
+
+        std::vector<float> lhs(1027);
+        std::vector<float> rhs(lhs.size(), 0.5f);
+        std::iota(lhs.begin(), lhs.end(), 0.0f);
+        std::vector<float> output(lhs.size());
+
+        mapSimd(multiplyAdd, std::span{output}, std::span{lhs}, std::span<float const>{rhs});
+        for (std::size_t row = 0; row < output.size(); ++row)
+            ASSERT_FLOAT_EQ(output[row], lhs[row] * 0.5f + 1.0f);
+    }
+
+    TEST_F(MapSimdTests, ScalarOnlyFunctionsFallBack)
+    {
+        auto scalarOnly = [](double value) {
+            return std::sqrt(value);
+        };
+#if TRAITS_LIB_HAS_SIMD
+        EXPECT_FALSE((Detail::IsSimdInvocable<decltype(scalarOnly), double, double>));
+#endif
+
+        std::vector<double> input{1.0, 4.0, 9.0, 16.0, 25.0};
+        std::vector<double> output(input.size());
+        mapSimd(scalarOnly, std::span{output}, std::span{input});
+        EXPECT_EQ(output, (std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0}));
+    }
+
+    TEST_F(MapSimdTests, MixedColumnTypesAndConversions)
+    {
+        auto scale = [](auto value, auto factor) -> decltype(value * factor) {
+            return value * factor;
+        };
+        std::vector<std::int32_t> values(37);
+        std::vector<std::int32_t> factors(values.size(), 3);
+        std::iota(values.begin(), values.end(), 0);
+        std::vector<std::int64_t> output(values.size());
+
+        mapSimd(scale, std::span{output}, std::span{values}, std::span{factors});
+        for (std::size_t row = 0; row < output.size(); ++row)
+            ASSERT_EQ(output[row], static_cast<std::int64_t>(row) * 3);
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <traits/memoize.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct MemoizeTests : public ::testing::Test
+    {};
+
+    TEST_F(MemoizeTests, CachesResultsByArguments)
+    {
+        std::atomic<int> calls{0};
+        auto memoized = memoize(
+            [&calls](int lhs, int rhs) {
+                ++calls;
+                return lhs * rhs;
+            },
+            64);
+
+        EXPECT_EQ(memoized(3, 4), 12);
+        EXPECT_EQ(memoized(3, 4), 12);
+        EXPECT_EQ(memoized(4, 3), 12);
+        EXPECT_EQ(calls.load(), 2);
+        EXPECT_EQ(memoized.size(), 2u);
+
+        memoized.clear();
+        EXPECT_EQ(memoized(3, 4), 12);
+        EXPECT_EQ(calls.load(), 3);
+    }
+
+    TEST_F(MemoizeTests, HeterogeneousStringLookup)
+    {
+        std::atomic<int> calls{0};
+        auto length = memoize(
+            [&calls](std::string const& text) {
+                ++calls;
+                return text.size();
+            },
+            16);
+        EXPECT_TRUE((std::is_same_v<decltype(length)::KeyType, std::tuple<std::string>>));
+
+        std::string_view view = "memoized";
+        EXPECT_EQ(length(std::string{"memoized"}), 8u);
+        EXPECT_EQ(length(view), 8u);
+        EXPECT_EQ(length("memoized"), 8u);
+        EXPECT_EQ(calls.load(), 1);
+    }
+
+    TEST_F(MemoizeTests, ConvertedArgumentsMatchTheirKey)
+    {
+        std::atomic<int> calls{0};
+        auto scale = memoize(
+            [&calls](float value) {
+                ++calls;
+                return value * 2.0f;
+            },
+            16);
+        auto truncate = memoize(
+            [&calls](int value) {
+                ++calls;
+                return value;
+            },
+            16);
+
+        // 0.1 is not exactly representable as a float, the lookup still has to find the entry it was stored as.
+        EXPECT_EQ(scale(0.1), scale(0.1f));
+        EXPECT_EQ(truncate(1.5), 1);
+        EXPECT_EQ(truncate(1), 1);
+        EXPECT_EQ(calls.load(), 2);
+    }
+
+    TEST_F(MemoizeTests, StringViewKeysAreOwned)
+    {
+        auto firstCharacter = memoize(
+            [](std::string_view text) {
+                return text.front();
+            },
+            16);
+        EXPECT_TRUE((std::is_same_v<decltype(firstCharacter)::KeyType, std::tuple<std::string>>));
+
+        {
+            std::string temporary = "abc";
+            EXPECT_EQ(firstCharacter(std::string_view{temporary}), 'a');
+        }
+        EXPECT_EQ(firstCharacter("abc"), 'a');
+        EXPECT_EQ(firstCharacter.size(), 1u);
+    }
+
+    TEST_F(MemoizeTests, EvictsWhenFull)
+    {
+        std::atomic<int> calls{0};
+        auto memoized = memoize(
+            [&calls](int value) {
+                ++calls;
+                return value;
+            },
+            4,
+            1);
+
+        for (int value = 0; value != 10; ++value)
+            memoized(value);
+        EXPECT_EQ(memoized.size(), 4u);
+        EXPECT_EQ(calls.load(), 10);
+
+        // Recently inserted values are still cached, the first ones were evicted.
+        memoized(9);
+        EXPECT_EQ(calls.load(), 10);
+        memoized(0);
+        EXPECT_EQ(calls.load(), 11);
+    }
+
+    TEST_F(MemoizeTests, IsSafeToShareBetweenThreads)
+    {
+        std::atomic<int> calls{0};
+        auto square = memoize(
+            [&calls](int value) noexcept {
+                ++calls;
+                return value * value;
+            },
+            1024);
+
+        std::vector<std::thread> threads;
+        std::atomic<int> wrong{0};
+        for (int thread = 0; thread != 4; ++thread)
+            threads.emplace_back([&] {
+                for (int round = 0; round != 100; ++round)
+                    for (int value = 0; value != 100; ++value)
+                        if (square(value) != value * value)
+                            ++wrong;
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(wrong.load(), 0);
+        EXPECT_EQ(square.size(), 100u);
+        EXPECT_LE(calls.load(), 400);
+    }
+}
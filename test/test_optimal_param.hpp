@@ -0,0 +1,61 @@
+#pragma once
+
+#include <traits/optimal_param.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct OptimalParamTests : public ::testing::Test
+    {};
+
+    TEST_F(OptimalParamTests, SmallTriviallyCopyableTypesArePassedByValue)
+    {
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<int>, int>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<int const&>, int>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<double&&>, double>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<char const*>, char const*>));
+        using Small = std::array<char, sizeof(void*)>;
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<Small>, Small>));
+    }
+
+    TEST_F(OptimalParamTests, LargeOrNonTriviallyCopyableTypesArePassedByReference)
+    {
+        using Large = std::array<char, defaultByValueThreshold + 1>;
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<Large>, Large const&>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<std::string>, std::string const&>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<std::string&&>, std::string const&>));
+    }
+
+    TEST_F(OptimalParamTests, ThresholdIsConfigurable)
+    {
+        using Pair = std::array<int, 4>;
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<Pair, 8>, Pair const&>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<Pair, 16>, Pair>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamType<int, 0>, int const&>));
+    }
+
+    TEST_F(OptimalParamTests, OptimalParamsOfFunctions)
+    {
+        using Large = std::array<char, 64>;
+        auto lambda = [](int const&, std::string, Large const&, float&&) {};
+        using Lambda = decltype(lambda);
+
+        EXPECT_TRUE((std::is_same_v<OptimalParamOf<Lambda, 0>, int>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamOf<Lambda, 1>, std::string const&>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamOf<Lambda, 2>, Large const&>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamOf<Lambda, 2, 64>, Large>));
+        EXPECT_TRUE((std::is_same_v<
+                     OptimalArgsTupleOf<Lambda>,
+                     std::tuple<int, std::string const&, Large const&, float>>));
+        EXPECT_TRUE((std::is_same_v<
+                     OptimalArgsTypeListOf<decltype(lambda), 64>,
+                     TypeList<int, std::string const&, Large, float>>));
+        EXPECT_TRUE((std::is_same_v<OptimalParamOf<void (*)(Large), 0>, Large const&>));
+    }
+}
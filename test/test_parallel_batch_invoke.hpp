@@ -0,0 +1,145 @@
+#pragma once
+
+#include <traits/parallel_batch_invoke.hpp>
+#include <traits/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    std::int64_t squarePlus(std::int64_t value, std::int32_t offset) noexcept
+    {
+        return value * value + offset;
+    }
+
+    struct ParallelBatchInvokeTests : public ::testing::Test
+    {};
+
+    TEST_F(ParallelBatchInvokeTests, PoolRunsPostedTasks)
+    {
+        std::atomic<int> counter{0};
+        {
+            WorkStealingPool pool{3};
+            EXPECT_EQ(pool.size(), 3u);
+            for (int task = 0; task != 100; ++task)
+                pool.post([&counter]() noexcept {
+                    counter.fetch_add(1);
+                });
+        }
+        EXPECT_EQ(counter.load(), 100);
+    }
+
+    TEST_F(ParallelBatchInvokeTests, ComputesAllRows)
+    {
+        std::vector<std::int64_t> values(100'003);
+        std::vector<std::int32_t> offsets(values.size(), 7);
+        std::iota(values.begin(), values.end(), 0);
+        std::vector<std::int64_t> output(values.size());
+
+        WorkStealingPool pool{4};
+        parallelInvokeBatch(
+            ParallelBatchOptions{.chunkBytes = 4096, .pool = &pool},
+            squarePlus,
+            std::span{output},
+            std::span{values},
+            std::span{offsets});
+
+        for (std::size_t row = 0; row < output.size(); ++row)
+            ASSERT_EQ(output[row], static_cast<std::int64_t>(row * row + 7));
+    }
+
+    TEST_F(ParallelBatchInvokeTests, AcceptsConstAndStatelessCallables)
+    {
+        std::vector<float> input(10'000, 2.0f);
+        std::vector<float> output(input.size());
+        float const factor = 3.0f;
+
+        parallelInvokeBatch(
+            [factor](float value) {
+                return value * factor;
+            },
+            std::span{output},
+            std::span{input});
+        EXPECT_FLOAT_EQ(output.back(), 6.0f);
+
+        parallelInvokeBatch(
+            [](float value) mutable {
+                return value + 1.0f;
+            },
+            std::span{output},
+            std::span{input});
+        EXPECT_FLOAT_EQ(output.front(), 3.0f);
+    }
+
+    TEST_F(ParallelBatchInvokeTests, PropagatesExceptions)
+    {
+        std::vector<int> input(50'000);
+        std::iota(input.begin(), input.end(), 0);
+        std::vector<int> output(input.size());
+
+        auto throwing = [](int value) {
+            if (value == 31'337)
+                throw std::runtime_error("bad row");
+            return value;
+        };
+        EXPECT_THROW(
+            parallelInvokeBatch(
+                ParallelBatchOptions{.chunkBytes = 1024}, throwing, std::span{output}, std::span{input}),
+            std::runtime_error);
+
+        auto alwaysThrowing = [](int) -> int {
+            throw std::runtime_error("every row");
+        };
+        WorkStealingPool pool{4};
+        try
+        {
+            parallelInvokeBatch(
+                ParallelBatchOptions{.chunkBytes = 64, .pool = &pool},
+                alwaysThrowing,
+                std::span{output},
+                std::span{input});
+            FAIL();
+        }
+        catch (AggregateException const& exception)
+        {
+            EXPECT_GT(exception.exceptions().size(), 1u);
+        }
+        catch (std::runtime_error const&)
+        {
+            // All other participants may have finished before the first exception was seen.
+        }
+    }
+
+    TEST_F(ParallelBatchInvokeTests, NestedCallsFromWorkersComplete)
+    {
+        WorkStealingPool pool{2};
+        std::vector<int> input(4096, 1);
+        std::atomic<int> finished{0};
+
+        for (int task = 0; task != 4; ++task)
+            pool.post([&]() noexcept {
+                std::vector<int> output(input.size());
+                parallelInvokeBatch(
+                    ParallelBatchOptions{.chunkBytes = 256, .pool = &pool},
+                    [](int value) noexcept {
+                        return value * 2;
+                    },
+                    std::span{output},
+                    std::span{input});
+                if (output.back() == 2)
+                    finished.fetch_add(1);
+            });
+
+        while (finished.load() != 4)
+            pool.runPendingTask();
+        EXPECT_EQ(finished.load(), 4);
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <traits/registry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Traits::Tests
+{
+    int quadruple(int value) noexcept
+    {
+        return value * 4;
+    }
+
+    struct RegistryTests : public ::testing::Test
+    {
+        template <typename RegistryT>
+        constexpr static bool canFind = requires(RegistryT& registry) { registry.template find<int(int)>("name"); };
+    };
+
+    TEST_F(RegistryTests, FindsCallablesByNameAndSignature)
+    {
+        Registry registry;
+        EXPECT_TRUE(registry.add("quadruple", quadruple));
+        EXPECT_TRUE(registry.add("greet", [](std::string const& name) {
+            return "hello " + name;
+        }));
+        EXPECT_EQ(registry.size(), 2u);
+
+        auto quadrupleHandle = registry.find<int(int) noexcept>("quadruple");
+        ASSERT_TRUE(static_cast<bool>(quadrupleHandle));
+        EXPECT_EQ(quadrupleHandle(2), 8);
+
+        auto greet = registry.find<std::string(std::string const&)>("greet");
+        ASSERT_TRUE(static_cast<bool>(greet));
+        EXPECT_EQ(greet("world"), "hello world");
+        EXPECT_TRUE((std::is_same_v<decltype(greet), RegistryHandle<std::string(std::string const&)>>));
+    }
+
+    TEST_F(RegistryTests, SignatureMustMatch)
+    {
+        Registry registry;
+        registry.add("quadruple", quadruple);
+
+        EXPECT_FALSE(static_cast<bool>(registry.find<int(int)>("quadruple")));
+        EXPECT_FALSE(static_cast<bool>(registry.find<long(int) noexcept>("quadruple")));
+        EXPECT_FALSE(static_cast<bool>(registry.find<int(int) noexcept>("missing")));
+        EXPECT_TRUE(static_cast<bool>(registry.find<int(int) const noexcept>("quadruple")));
+
+        // Handles may invoke mutable callables, so a const registry does not hand them out.
+        static_assert(canFind<Registry> && !canFind<Registry const>);
+    }
+
+    TEST_F(RegistryTests, OneNameCanHoldSeveralSignatures)
+    {
+        Registry registry;
+        EXPECT_TRUE(registry.add("convert", [](int value) {
+            return value + 1;
+        }));
+        EXPECT_TRUE(registry.add("convert", [](double value) {
+            return value * 2;
+        }));
+        EXPECT_FALSE(registry.add("convert", [](int value) {
+            return value;
+        }));
+
+        EXPECT_EQ(registry.find<int(int)>("convert")(1), 2);
+        EXPECT_DOUBLE_EQ(registry.find<double(double)>("convert")(1.5), 3.0);
+    }
+
+    TEST_F(RegistryTests, KeepsStatefulCallablesAcrossRehashes)
+    {
+        Registry registry;
+        auto shared = std::make_shared<int>(0);
+        registry.add("increment", [shared]() mutable {
+            return ++*shared;
+        });
+        for (int index = 0; index != 200; ++index)
+            registry.add("entry" + std::to_string(index), [index]() {
+                return index;
+            });
+
+        EXPECT_EQ(registry.size(), 201u);
+        EXPECT_EQ(registry.find<int()>("increment")(), 1);
+        EXPECT_EQ(registry.find<int()>("increment")(), 2);
+        for (int index = 0; index != 200; ++index)
+            ASSERT_EQ(registry.find<int()>("entry" + std::to_string(index))(), index);
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+
+    TEST_F(RegistryTests, EraseKeepsOtherEntriesReachable)
+    {
+        Registry registry;
+        for (int index = 0; index != 100; ++index)
+            registry.add(std::to_string(index), [index]() {
+                return index;
+            });
+
+        for (int index = 0; index < 100; index += 3)
+            EXPECT_TRUE(registry.erase<int()>(std::to_string(index)));
+        EXPECT_FALSE(registry.erase<int()>("0"));
+
+        for (int index = 0; index != 100; ++index)
+        {
+            auto handle = registry.find<int()>(std::to_string(index));
+            if (index % 3 == 0)
+                EXPECT_FALSE(static_cast<bool>(handle));
+            else
+                ASSERT_EQ(handle(), index);
+        }
+
+        auto shared = std::make_shared<int>(1);
+        {
+            Registry owning;
+            owning.add("holder", [shared]() {
+                return *shared;
+            });
+            Registry moved = std::move(owning);
+            EXPECT_EQ(moved.find<int()>("holder")(), 1);
+        }
+        EXPECT_EQ(shared.use_count(), 1);
+    }
+
+    TEST_F(RegistryTests, NamesAreStoredInline)
+    {
+        Registry registry;
+        std::string const longest(Registry::maxNameLength, 'x');
+        EXPECT_TRUE(registry.add(longest, []() {
+            return 1;
+        }));
+        EXPECT_EQ(registry.find<int()>(longest)(), 1);
+
+        std::string const tooLong(Registry::maxNameLength + 1, 'x');
+        auto two = []() {
+            return 2;
+        };
+        EXPECT_THROW(registry.add(tooLong, two), std::length_error);
+        EXPECT_FALSE(static_cast<bool>(registry.find<int()>(tooLong)));
+        EXPECT_EQ(registry.size(), 1u);
+    }
+}
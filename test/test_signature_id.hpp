@@ -0,0 +1,58 @@
+#pragma once
+
+#include <traits/signature_id.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+namespace Traits::Tests
+{
+    struct SignatureIdTests : public ::testing::Test
+    {
+        int member(double) const noexcept
+        {
+            return 0;
+        }
+    };
+
+    TEST_F(SignatureIdTests, IsAConstantOfTheSignature)
+    {
+        constexpr std::uint64_t id = signatureIdOf<int (*)(double)>;
+        static_assert(id != 0);
+        static_assert(id == signatureIdOf<int(double)>);
+
+        auto lambda = [](double) {
+            return 0;
+        };
+        EXPECT_EQ(signatureIdOf<decltype(lambda)>, signatureIdOf<int(double) const>);
+        EXPECT_EQ(signatureIdOf<decltype(&SignatureIdTests::member)>, signatureIdOf<int(double) const noexcept>);
+    }
+
+    TEST_F(SignatureIdTests, DistinguishesTypesAndQualifiers)
+    {
+        EXPECT_NE(signatureIdOf<int(double)>, signatureIdOf<int(float)>);
+        EXPECT_NE(signatureIdOf<int(double)>, signatureIdOf<long(double)>);
+        EXPECT_NE(signatureIdOf<int(double)>, signatureIdOf<int(double) noexcept>);
+        EXPECT_NE(signatureIdOf<int(double)>, signatureIdOf<int(double) const>);
+        EXPECT_NE(signatureIdOf<int(double)>, signatureIdOf<int(double const&)>);
+        EXPECT_NE(signatureIdOf<void(int, int)>, signatureIdOf<void(int)>);
+        EXPECT_NE(signatureIdOf<void(std::string)>, signatureIdOf<void(std::string&&)>);
+    }
+
+    TEST_F(SignatureIdTests, CollisionCheck)
+    {
+        static_assert(signatureIdsAreUnique<>);
+        static_assert(signatureIdsAreUnique<
+                      void(),
+                      void() noexcept,
+                      int(int),
+                      int(long),
+                      std::string(std::string const&),
+                      void (*)(int, double, char),
+                      decltype(&SignatureIdTests::member)>);
+        static_assert(signatureIdsAreUnique<int(int), int (*)(int), int(int)>);
+        SUCCEED();
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <traits/task.hpp>
+
+#include <gtest/gtest.h>
+
+#include <coroutine>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct TaskTests : public ::testing::Test
+    {
+        /// Resumes the awaiting coroutine on another thread.
+        struct ResumeOnThread
+        {
+            std::jthread& thread;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                // The awaiter lives in the frame, which may be gone as soon as the thread started.
+                auto& target = thread;
+                target = std::jthread{[handle] {
+                    handle.resume();
+                }};
+            }
+
+            void await_resume() const noexcept
+            {}
+        };
+
+        static Task<int> twice(int value)
+        {
+            co_return value * 2;
+        }
+
+        static int increment(int value) noexcept
+        {
+            return value + 1;
+        }
+    };
+
+    TEST_F(TaskTests, CoroutineTraits)
+    {
+        static_assert(IsCoroutine<decltype(&twice)> && IsAwaitable<Task<int>>);
+        static_assert(std::is_same_v<AwaitResultOf<decltype(&twice)>, int>);
+
+        static_assert(!IsCoroutine<decltype(&increment)> && !IsAwaitable<int>);
+        static_assert(std::is_same_v<AwaitResultOf<decltype(&increment)>, int>);
+
+        static_assert(IsAwaitable<Task<std::string>> && !IsAwaitable<Task<std::string>&>);
+        static_assert(IsAwaitable<ResumeOnThread> && IsAwaitable<std::suspend_always>);
+        static_assert(std::is_same_v<AwaitedType<Task<std::string>>, std::string>);
+        static_assert(std::is_same_v<AwaitedType<ReadyAwaiter<int&>>, int&>);
+        static_assert(std::is_base_of_v<PooledCoroutineFrame, Task<>::promise_type>);
+    }
+
+    TEST_F(TaskTests, InvokeAsyncAwaitsOnlyAwaitables)
+    {
+        static_assert(std::is_same_v<decltype(invokeAsync(twice, 1)), Task<int>>);
+        static_assert(std::is_same_v<decltype(invokeAsync(increment, 1)), ReadyAwaiter<int>>);
+        static_assert(std::is_same_v<decltype(invokeAsync([] {})), ReadyAwaiter<void>>);
+
+        // A result that may throw while it is moved into the ReadyAwaiter makes invokeAsync potentially throwing.
+        struct ThrowingMove
+        {
+            ThrowingMove() = default;
+            ThrowingMove(ThrowingMove&&) noexcept(false)
+            {}
+        };
+        static_assert(noexcept(invokeAsync(increment, 1)));
+        static_assert(!noexcept(invokeAsync([]() noexcept { return ThrowingMove{}; })));
+
+        auto pipeline = []() -> Task<int> {
+            auto const doubled = co_await invokeAsync(twice, 20);
+            co_return co_await invokeAsync(increment, doubled);
+        };
+        EXPECT_EQ(syncWait(pipeline()), 41);
+        EXPECT_EQ(syncWait(invokeAsync(increment, 1)), 2);
+
+        int value = 1;
+        int& reference = syncWait(invokeAsync([&]() -> int& { return value; }));
+        EXPECT_EQ(&reference, &value);
+    }
+
+    TEST_F(TaskTests, ResumesAcrossThreadsAndPropagatesExceptions)
+    {
+        std::jthread thread;
+        auto const caller = std::this_thread::get_id();
+        auto hop = [&]() -> Task<std::thread::id> {
+            co_await ResumeOnThread{thread};
+            co_return std::this_thread::get_id();
+        };
+        EXPECT_NE(syncWait(hop()), caller);
+
+        auto failing = [&]() -> Task<> {
+            co_await ResumeOnThread{thread};
+            throw std::runtime_error{"failed"};
+        };
+        auto outer = [&]() -> Task<std::string> {
+            try
+            {
+                co_await failing();
+            }
+            catch (std::runtime_error const& error)
+            {
+                co_return error.what();
+            }
+            co_return "";
+        };
+        EXPECT_EQ(syncWait(outer()), "failed");
+    }
+
+    TEST_F(TaskTests, RecyclesFrames)
+    {
+        auto* frame = CoroutineFramePool::allocate(100);
+        CoroutineFramePool::deallocate(frame, 100);
+        auto const cached = CoroutineFramePool::cachedFrames();
+        EXPECT_GE(cached, 1u);
+        EXPECT_EQ(CoroutineFramePool::allocate(128), frame);
+        EXPECT_EQ(CoroutineFramePool::cachedFrames(), cached - 1);
+        CoroutineFramePool::deallocate(frame, 128);
+
+        for (int run = 0; run != 3; ++run)
+            EXPECT_EQ(syncWait(twice(run)), run * 2);
+        auto const steady = CoroutineFramePool::cachedFrames();
+        EXPECT_EQ(syncWait(twice(4)), 8);
+        EXPECT_EQ(CoroutineFramePool::cachedFrames(), steady);
+
+        auto* large = CoroutineFramePool::allocate(CoroutineFramePool::maxPooledSize + 1);
+        CoroutineFramePool::deallocate(large, CoroutineFramePool::maxPooledSize + 1);
+        EXPECT_EQ(CoroutineFramePool::cachedFrames(), steady);
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <traits/task_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct TaskQueueTests : public ::testing::Test
+    {};
+
+    TEST_F(TaskQueueTests, RunsTasksInOrder)
+    {
+        TaskQueue<void(std::vector<int>&) noexcept> queue{4};
+        EXPECT_EQ(queue.capacity(), 4u);
+
+        for (int value = 0; value != 4; ++value)
+            EXPECT_TRUE(queue.tryPush([value](std::vector<int>& values) noexcept { values.push_back(value); }));
+        EXPECT_FALSE(queue.tryPush([](std::vector<int>&) noexcept {}));
+
+        std::vector<int> values;
+        while (queue.tryRun(values))
+        {}
+        EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3}));
+
+        // The slots are reused after they were run.
+        EXPECT_TRUE(queue.tryPush([](std::vector<int>& values) noexcept { values.clear(); }));
+        EXPECT_TRUE(queue.tryRun(values));
+        EXPECT_TRUE(values.empty());
+    }
+
+    TEST_F(TaskQueueTests, ReturnsResults)
+    {
+        TaskQueueOf<int (*)(int)> queue{2};
+        EXPECT_TRUE((std::is_same_v<decltype(queue), TaskQueue<int(int)>>));
+        EXPECT_FALSE(queue.tryRun(1).has_value());
+
+        queue.tryPush([](int value) { return value * 2; });
+        EXPECT_EQ(queue.tryRun(21), 42);
+    }
+
+    TEST_F(TaskQueueTests, DestroysTasks)
+    {
+        auto counter = std::make_shared<int>(0);
+        {
+            TaskQueue<void()> queue{8};
+            queue.tryPush([counter] {});
+            queue.tryPush([counter] {});
+            EXPECT_EQ(counter.use_count(), 3);
+            queue.tryRun();
+            EXPECT_EQ(counter.use_count(), 2);
+        }
+        EXPECT_EQ(counter.use_count(), 1);
+    }
+
+    TEST_F(TaskQueueTests, ThrowingTasksReleaseTheirSlot)
+    {
+        TaskQueue<void()> queue{2};
+        queue.tryPush([] { throw std::runtime_error{"task"}; });
+        EXPECT_THROW(queue.tryRun(), std::runtime_error);
+        EXPECT_FALSE(queue.tryRun());
+        EXPECT_TRUE(queue.tryPush([] {}));
+        EXPECT_TRUE(queue.tryRun());
+    }
+
+    TEST_F(TaskQueueTests, MultipleProducers)
+    {
+        constexpr int producerCount = 4;
+        constexpr int tasksPerProducer = 10000;
+        TaskQueue<void(long&) noexcept> queue{64};
+
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer != producerCount; ++producer)
+            producers.emplace_back([&queue, producer] {
+                for (int task = 0; task != tasksPerProducer; ++task)
+                    while (!queue.tryPush([value = producer * tasksPerProducer + task](long& sum) noexcept {
+                        sum += value;
+                    }))
+                        std::this_thread::yield();
+            });
+
+        long sum = 0;
+        for (int run = 0; run != producerCount * tasksPerProducer;)
+            run += queue.tryRun(sum);
+        for (auto& producer : producers)
+            producer.join();
+
+        long const count = producerCount * tasksPerProducer;
+        EXPECT_EQ(sum, count * (count - 1) / 2);
+        EXPECT_FALSE(queue.tryRun(sum));
+    }
+}
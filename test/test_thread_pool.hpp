@@ -0,0 +1,107 @@
+#pragma once
+
+#include <traits/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Traits::Tests
+{
+    struct ThreadPoolTests : public ::testing::Test
+    {};
+
+    TEST_F(ThreadPoolTests, SubmitReturnsResults)
+    {
+        WorkStealingPool pool{2};
+        auto sum = pool.submit([](int lhs, int rhs) { return lhs + rhs; }, 40, 2);
+        auto text = pool.submit([](std::string const& value) { return value + "!"; }, std::string{"submitted"});
+        auto generic = pool.submit([](auto value) noexcept { return value * 2; }, 2.5);
+
+        EXPECT_TRUE((std::is_same_v<decltype(sum), TaskResult<int, false>>));
+        EXPECT_TRUE((std::is_same_v<decltype(generic), TaskResult<double, true>>));
+        EXPECT_TRUE(sum.valid());
+        EXPECT_EQ(sum.get(), 42);
+        EXPECT_FALSE(sum.valid());
+        EXPECT_EQ(text.get(), "submitted!");
+        EXPECT_EQ(generic.get(), 5.0);
+    }
+
+    TEST_F(ThreadPoolTests, SubmitVoidFunctions)
+    {
+        WorkStealingPool pool{2};
+        std::atomic<int> calls{0};
+        std::vector<TaskResult<void, true>> results;
+        for (int index = 0; index != 100; ++index)
+            results.push_back(pool.submit([&calls]() noexcept { ++calls; }));
+        for (auto& result : results)
+            result.get();
+        EXPECT_EQ(calls.load(), 100);
+    }
+
+    TEST_F(ThreadPoolTests, SubmitPropagatesExceptions)
+    {
+        WorkStealingPool pool{1};
+        auto result = pool.submit([](int value) -> int { throw std::runtime_error{std::to_string(value)}; }, 7);
+        try
+        {
+            result.get();
+            FAIL() << "The exception was not propagated.";
+        }
+        catch (std::runtime_error const& error)
+        {
+            EXPECT_EQ(std::string{error.what()}, "7");
+        }
+
+        // Noexcept functions do not store an exception.
+        EXPECT_LT((sizeof(Detail::ResultSlot<int, true>)), (sizeof(Detail::ResultSlot<int, false>)));
+    }
+
+    TEST_F(ThreadPoolTests, AbandonedResultsAreRecycled)
+    {
+        using Arena = Detail::ResultSlotArena<Detail::ResultSlot<int, false>>;
+        constexpr int tasksPerRound = 1000;
+
+        WorkStealingPool pool{2};
+        std::atomic<int> calls{0};
+        auto runRound = [&] {
+            // The slots are acquired here and released by the workers when the abandoned tasks finish.
+            calls.store(0);
+            for (int index = 0; index != tasksPerRound; ++index)
+                pool.submit([&calls] { return ++calls; });
+            while (calls.load() != tasksPerRound)
+                pool.runPendingTask();
+        };
+
+        auto const chunksBefore = Arena::chunkCount();
+        for (int round = 0; round != 50; ++round)
+            runRound();
+
+        // Released slots flow back to the submitting thread: besides the tasks of one round only the bounded local
+        // lists of the three threads hold slots.
+        EXPECT_LE(
+            Arena::chunkCount(),
+            chunksBefore + (tasksPerRound + 3 * Arena::localLimit) / Arena::chunkSize + 1);
+        EXPECT_EQ(pool.submit([] { return 1; }).get(), 1);
+    }
+
+    TEST_F(ThreadPoolTests, NestedSubmitDoesNotDeadlock)
+    {
+        WorkStealingPool pool{1};
+        auto outer = pool.submit([&pool] {
+            int sum = 0;
+            std::vector<TaskResult<int, true>> inner;
+            for (int index = 0; index != 10; ++index)
+                inner.push_back(pool.submit([index]() noexcept { return index; }));
+            for (auto& result : inner)
+                sum += result.get();
+            return sum;
+        });
+        EXPECT_EQ(outer.get(), 45);
+    }
+}
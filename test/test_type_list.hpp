@@ -0,0 +1,55 @@
+#pragma once
+
+#include <traits/type_list.hpp>
+#include <traits/functions.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+namespace Traits::Tests
+{
+    struct TypeListTests : public ::testing::Test
+    {};
+
+    TEST_F(TypeListTests, PackElementSelectsTypeAtIndex)
+    {
+        EXPECT_TRUE((std::is_same_v<PackElement<0, int, double const&, char*>, int>));
+        EXPECT_TRUE((std::is_same_v<PackElement<1, int, double const&, char*>, double const&>));
+        EXPECT_TRUE((std::is_same_v<PackElement<2, int, double const&, char*>, char*>));
+    }
+
+    TEST_F(TypeListTests, FlatFallbackSelectsTypeAtIndex)
+    {
+        EXPECT_TRUE((std::is_same_v<Detail::PackElementFlat<0, void, int&&>::type, void>));
+        EXPECT_TRUE((std::is_same_v<Detail::PackElementFlat<1, void, int&&>::type, int&&>));
+        EXPECT_TRUE((std::is_same_v<Detail::PackElementFlat<1, int, int, int>::type, int>));
+    }
+
+    TEST_F(TypeListTests, TypeListSizeAndAt)
+    {
+        using List = TypeList<int, std::string const&, float>;
+        EXPECT_EQ(List::size, 3);
+        EXPECT_EQ(TypeList<>::size, 0);
+        EXPECT_TRUE((std::is_same_v<List::At<1>, std::string const&>));
+    }
+
+    TEST_F(TypeListTests, FunctionTraitsProvideArgsTypeList)
+    {
+        using Traits = FunctionTraits<void(int, std::string const&)>;
+        EXPECT_TRUE((std::is_same_v<Traits::ArgsTypeList, TypeList<int, std::string const&>>));
+        EXPECT_TRUE((std::is_same_v<Traits::ArgsTypeListDecayed, TypeList<int, std::string>>));
+    }
+
+    TEST_F(TypeListTests, CanAccessEveryArgumentOfWideSignature)
+    {
+        using Traits = FunctionTraits<
+            void(char, short, int, long, float, double, char const&, short const&, int const&, long const&, float&&)>;
+        EXPECT_EQ(Traits::arity, 11);
+        EXPECT_TRUE((std::is_same_v<Traits::Argument<0>, char>));
+        EXPECT_TRUE((std::is_same_v<Traits::Argument<5>, double>));
+        EXPECT_TRUE((std::is_same_v<Traits::Argument<9>, long const&>));
+        EXPECT_TRUE((std::is_same_v<Traits::ArgumentDecayed<10>, float>));
+    }
+}